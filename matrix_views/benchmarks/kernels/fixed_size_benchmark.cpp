@@ -0,0 +1,292 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "kernels/fixed_size.hpp"
+#include "kernels/reduce.hpp"
+#include "matrices/matrix.hpp"
+
+namespace benchmarks {
+
+using namespace matrix_views::kernels;
+using namespace matrix_views::matrices;
+using namespace matrix_views::utils;
+using matrix_views::utils::index;
+
+namespace {
+
+/*
+ * 10^8 small-matrix operations in total, split into batches of independent
+ * matrices so that the loop over a batch stays in L1
+ */
+constexpr std::int64_t kBatch = 1000;
+constexpr std::int64_t kOperations = 100'000'000;
+
+template <typename Matrix>
+std::vector<Matrix> make_matrices(std::size_t n) {
+  auto matrices = std::vector<Matrix>();
+  for (std::int64_t k = 0; k < kBatch; ++k) {
+    auto m = Matrix(n, n);
+    std::iota(m.data(), m.data() + m.size(), static_cast<float>(k % 7));
+    matrices.push_back(std::move(m));
+  }
+  return matrices;
+}
+
+template <std::size_t N>
+void benchmark_multiply_fixed(benchmark::State& state) {
+  const auto lhs = make_matrices<matrix<float, N, N>>(N);
+  const auto rhs = make_matrices<matrix<float, N, N>>(N);
+  auto destination = make_matrices<matrix<float, N, N>>(N);
+
+  for (auto _ : state) {
+    for (std::int64_t k = 0; k < kBatch; ++k) {
+      multiply(lhs[k], rhs[k], destination[k]);
+    }
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * kBatch);
+}
+
+/*
+ * The same product over matrices with runtime dimensions by a plain nested
+ * loop, as written without the kernels
+ */
+template <std::size_t N>
+void benchmark_multiply_dynamic(benchmark::State& state) {
+  const auto lhs = make_matrices<matrix<float>>(N);
+  const auto rhs = make_matrices<matrix<float>>(N);
+  auto destination = make_matrices<matrix<float>>(N);
+
+  for (auto _ : state) {
+    for (std::int64_t k = 0; k < kBatch; ++k) {
+      const auto n = static_cast<std::ptrdiff_t>(lhs[k].rows());
+      for (std::ptrdiff_t i = 0; i < n; ++i) {
+        for (std::ptrdiff_t j = 0; j < n; ++j) {
+          auto product = 0.f;
+          for (std::ptrdiff_t l = 0; l < n; ++l) {
+            product += lhs[k]({i, l}) * rhs[k]({l, j});
+          }
+          destination[k]({i, j}) = product;
+        }
+      }
+    }
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * kBatch);
+}
+
+template <std::size_t N>
+void benchmark_row_sums_fixed(benchmark::State& state) {
+  const auto matrices = make_matrices<matrix<float, N, N>>(N);
+
+  for (auto _ : state) {
+    for (std::int64_t k = 0; k < kBatch; ++k) {
+      benchmark::DoNotOptimize(reduce(kRow, matrices[k]));
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * kBatch);
+}
+
+template <std::size_t N>
+void benchmark_row_sums_dynamic(benchmark::State& state) {
+  const auto matrices = make_matrices<matrix<float>>(N);
+
+  for (auto _ : state) {
+    for (std::int64_t k = 0; k < kBatch; ++k) {
+      for (const auto row : rows(matrices[k])) {
+        benchmark::DoNotOptimize(sum(row));
+      }
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * kBatch);
+}
+
+/*
+ * Matrices with the diagonal raised to make them diagonally dominant and
+ * hence invertible
+ */
+template <typename Matrix>
+std::vector<Matrix> make_invertible_matrices(std::size_t n) {
+  auto matrices = make_matrices<Matrix>(n);
+  for (auto& m : matrices) {
+    for (std::ptrdiff_t i = 0; i < static_cast<std::ptrdiff_t>(n); ++i) {
+      m({i, i}) += 100.f;
+    }
+  }
+  return matrices;
+}
+
+/*
+ * Gaussian elimination with partial pivoting of the matrix in place, applied
+ * to the rows of the other matrix alongside. Returns the determinant
+ */
+float eliminate(matrix<float>& m, matrix<float>* other) {
+  const auto n = static_cast<std::ptrdiff_t>(m.rows());
+  auto determinant = 1.f;
+  for (std::ptrdiff_t j = 0; j < n; ++j) {
+    auto pivot = j;
+    for (std::ptrdiff_t i = j + 1; i < n; ++i) {
+      if (std::abs(m({i, j})) > std::abs(m({pivot, j}))) {
+        pivot = i;
+      }
+    }
+    if (m({pivot, j}) == 0.f) {
+      return 0.f;
+    }
+    if (pivot != j) {
+      determinant = -determinant;
+      for (std::ptrdiff_t l = 0; l < n; ++l) {
+        std::swap(m({pivot, l}), m({j, l}));
+        if (other != nullptr) {
+          std::swap((*other)({pivot, l}), (*other)({j, l}));
+        }
+      }
+    }
+    determinant *= m({j, j});
+
+    for (std::ptrdiff_t i = other != nullptr ? 0 : j + 1; i < n; ++i) {
+      if (i == j) {
+        continue;
+      }
+      const auto factor = m({i, j}) / m({j, j});
+      for (std::ptrdiff_t l = 0; l < n; ++l) {
+        m({i, l}) -= factor * m({j, l});
+        if (other != nullptr) {
+          (*other)({i, l}) -= factor * (*other)({j, l});
+        }
+      }
+    }
+  }
+  return determinant;
+}
+
+template <std::size_t N>
+void benchmark_inverse_fixed(benchmark::State& state) {
+  const auto matrices = make_invertible_matrices<matrix<float, N, N>>(N);
+  auto destination = make_matrices<matrix<float, N, N>>(N);
+
+  for (auto _ : state) {
+    for (std::int64_t k = 0; k < kBatch; ++k) {
+      benchmark::DoNotOptimize(inverse(matrices[k], destination[k]));
+    }
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * kBatch);
+}
+
+/*
+ * Gauss-Jordan elimination over matrices with runtime dimensions, reducing a
+ * copy of every matrix to the identity. The copies are allocated up front
+ */
+template <std::size_t N>
+void benchmark_inverse_dynamic(benchmark::State& state) {
+  const auto matrices = make_invertible_matrices<matrix<float>>(N);
+  auto scratch = make_matrices<matrix<float>>(N);
+  auto destination = make_matrices<matrix<float>>(N);
+
+  for (auto _ : state) {
+    for (std::int64_t k = 0; k < kBatch; ++k) {
+      std::copy_n(matrices[k].data(), matrices[k].size(), scratch[k].data());
+      std::fill_n(destination[k].data(), destination[k].size(), 0.f);
+      for (std::ptrdiff_t i = 0; i < static_cast<std::ptrdiff_t>(N); ++i) {
+        destination[k]({i, i}) = 1.f;
+      }
+      if (eliminate(scratch[k], &destination[k]) != 0.f) {
+        for (std::ptrdiff_t i = 0; i < static_cast<std::ptrdiff_t>(N); ++i) {
+          const auto reciprocal = 1.f / scratch[k]({i, i});
+          for (const auto row = destination[k].row(i); auto& value : row) {
+            value *= reciprocal;
+          }
+        }
+      }
+    }
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * kBatch);
+}
+
+template <std::size_t N>
+void benchmark_determinant_fixed(benchmark::State& state) {
+  const auto matrices = make_invertible_matrices<matrix<float, N, N>>(N);
+
+  for (auto _ : state) {
+    for (std::int64_t k = 0; k < kBatch; ++k) {
+      benchmark::DoNotOptimize(determinant(matrices[k]));
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * kBatch);
+}
+
+/*
+ * Gaussian elimination of a copy of every matrix with runtime dimensions
+ */
+template <std::size_t N>
+void benchmark_determinant_dynamic(benchmark::State& state) {
+  const auto matrices = make_invertible_matrices<matrix<float>>(N);
+  auto scratch = make_matrices<matrix<float>>(N);
+
+  for (auto _ : state) {
+    for (std::int64_t k = 0; k < kBatch; ++k) {
+      std::copy_n(matrices[k].data(), matrices[k].size(), scratch[k].data());
+      benchmark::DoNotOptimize(eliminate(scratch[k], nullptr));
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * kBatch);
+}
+
+template <std::size_t N>
+void register_benchmarks(const char* name) {
+  const auto iterations = kOperations / kBatch;
+  const auto path = [name](const char* benchmark) {
+    return std::string(benchmark) + "/" + name;
+  };
+
+  benchmark::RegisterBenchmark(path("multiply/fixed").c_str(),
+                               benchmark_multiply_fixed<N>)
+      ->Iterations(iterations);
+  benchmark::RegisterBenchmark(path("multiply/dynamic").c_str(),
+                               benchmark_multiply_dynamic<N>)
+      ->Iterations(iterations);
+  benchmark::RegisterBenchmark(path("row_sums/fixed").c_str(),
+                               benchmark_row_sums_fixed<N>)
+      ->Iterations(iterations);
+  benchmark::RegisterBenchmark(path("row_sums/dynamic").c_str(),
+                               benchmark_row_sums_dynamic<N>)
+      ->Iterations(iterations);
+  benchmark::RegisterBenchmark(path("inverse/fixed").c_str(),
+                               benchmark_inverse_fixed<N>)
+      ->Iterations(iterations);
+  benchmark::RegisterBenchmark(path("inverse/dynamic").c_str(),
+                               benchmark_inverse_dynamic<N>)
+      ->Iterations(iterations);
+  benchmark::RegisterBenchmark(path("determinant/fixed").c_str(),
+                               benchmark_determinant_fixed<N>)
+      ->Iterations(iterations);
+  benchmark::RegisterBenchmark(path("determinant/dynamic").c_str(),
+                               benchmark_determinant_dynamic<N>)
+      ->Iterations(iterations);
+}
+
+const bool kRegistered = [] {
+  register_benchmarks<3>("3x3");
+  register_benchmarks<4>("4x4");
+  return true;
+}();
+
+}  // namespace
+
+}  // namespace benchmarks
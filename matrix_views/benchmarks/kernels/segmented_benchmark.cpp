@@ -0,0 +1,136 @@
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+#include <numeric>
+#include <string>
+
+#include "kernels/segmented.hpp"
+#include "matrices/matrix.hpp"
+#include "matrices/tiled_matrix.hpp"
+
+namespace benchmarks {
+
+using namespace matrix_views::matrices;
+using namespace matrix_views::utils;
+
+namespace {
+
+/*
+ * Square matrix size and the tile size. All tiles fit into the cache, so
+ * this measures the per-element overhead rather than the disk
+ */
+constexpr std::int64_t kSizes[] = {1024, 4096};
+constexpr std::size_t kTileSize = 256;
+
+/*
+ * Tiled file of an n x n matrix, removed on destruction
+ */
+class matrix_file final {
+ public:
+  explicit matrix_file(std::size_t n)
+      : path_(std::filesystem::temp_directory_path() /
+              ("segmented_benchmark_" + std::to_string(n))) {
+    auto m = matrix<double>(n, n);
+    std::iota(m.data(), m.data() + m.size(), 0.);
+    tiled_matrix<double>::store(path_, m, kTileSize);
+  }
+  ~matrix_file() { std::filesystem::remove(path_); }
+
+  const std::filesystem::path& path() const noexcept { return path_; }
+
+ private:
+  std::filesystem::path path_;
+};
+
+tiled_matrix<double> make_tiled(const matrix_file& file, std::size_t n) {
+  return tiled_matrix<double>(file.path(), n, n, kTileSize,
+                              n * n * sizeof(double));
+}
+
+void benchmark_element_reduce(benchmark::State& state) {
+  const auto n = static_cast<std::size_t>(state.range(0));
+  const auto file = matrix_file(n);
+  const auto m = make_tiled(file, n);
+
+  for (auto _ : state) {
+    double total = 0;
+    for (const auto row : m.stripes(kRow)) {
+      total = std::accumulate(row.begin(), row.end(), total);
+    }
+    benchmark::DoNotOptimize(total);
+  }
+
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+void benchmark_segmented_reduce(benchmark::State& state) {
+  const auto n = static_cast<std::size_t>(state.range(0));
+  const auto file = matrix_file(n);
+  const auto m = make_tiled(file, n);
+
+  for (auto _ : state) {
+    double total = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+      total = matrix_views::kernels::reduce(
+          m.row(static_cast<std::ptrdiff_t>(i)), total);
+    }
+    benchmark::DoNotOptimize(total);
+  }
+
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+void benchmark_element_copy(benchmark::State& state) {
+  const auto n = static_cast<std::size_t>(state.range(0));
+  const auto file = matrix_file(n);
+  const auto m = make_tiled(file, n);
+  auto dense = matrix<double>(n, n);
+
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < n; ++i) {
+      const auto row = m.row(static_cast<std::ptrdiff_t>(i));
+      std::ranges::copy(row, dense.row(static_cast<std::ptrdiff_t>(i)).begin());
+    }
+    benchmark::DoNotOptimize(dense.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+void benchmark_segmented_copy(benchmark::State& state) {
+  const auto n = static_cast<std::size_t>(state.range(0));
+  const auto file = matrix_file(n);
+  const auto m = make_tiled(file, n);
+  auto dense = matrix<double>(n, n);
+
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < n; ++i) {
+      matrix_views::kernels::copy(m.row(static_cast<std::ptrdiff_t>(i)),
+                                  dense.row(static_cast<std::ptrdiff_t>(i)));
+    }
+    benchmark::DoNotOptimize(dense.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+const bool kRegistered = [] {
+  for (const auto n : kSizes) {
+    benchmark::RegisterBenchmark("tiled_reduce/element",
+                                 benchmark_element_reduce)
+        ->Arg(n);
+    benchmark::RegisterBenchmark("tiled_reduce/segmented",
+                                 benchmark_segmented_reduce)
+        ->Arg(n);
+    benchmark::RegisterBenchmark("tiled_copy/element", benchmark_element_copy)
+        ->Arg(n);
+    benchmark::RegisterBenchmark("tiled_copy/segmented",
+                                 benchmark_segmented_copy)
+        ->Arg(n);
+  }
+  return true;
+}();
+
+}  // namespace
+
+}  // namespace benchmarks
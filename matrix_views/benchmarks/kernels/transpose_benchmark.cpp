@@ -0,0 +1,141 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <numeric>
+#include <span>
+
+#include "kernels/transpose.hpp"
+#include "matrices/matrix.hpp"
+#include "parallel/transpose.hpp"
+
+namespace benchmarks {
+
+using namespace matrix_views::matrices;
+using namespace matrix_views::utils;
+
+namespace {
+
+/*
+ * Square matrix sizes. Powers of two map the columns of row-major storage
+ * onto few cache sets, which is the worst case for the naive copy
+ */
+constexpr std::int64_t kSizes[] = {1024, 4096};
+
+template <typename T>
+matrix<T> make_matrix(std::size_t n) {
+  auto m = matrix<T>(n, n);
+  std::iota(m.data(), m.data() + m.size(), T());
+  return m;
+}
+
+/*
+ * Copies every column of the source to the row of the destination
+ */
+template <typename T>
+void benchmark_naive(benchmark::State& state) {
+  const auto n = static_cast<std::size_t>(state.range(0));
+  const auto source = make_matrix<T>(n);
+  auto destination = matrix<T>(n, n);
+
+  for (auto _ : state) {
+    for (std::size_t j = 0; j < n; ++j) {
+      const auto k = static_cast<std::ptrdiff_t>(j);
+      std::ranges::copy(source.column(k), destination.row(k).begin());
+    }
+    benchmark::DoNotOptimize(destination.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+template <typename T>
+void benchmark_transpose(benchmark::State& state) {
+  const auto n = static_cast<std::size_t>(state.range(0));
+  const auto source = make_matrix<T>(n);
+  auto destination = matrix<T>(n, n);
+
+  for (auto _ : state) {
+    matrix_views::kernels::transpose(source, destination);
+    benchmark::DoNotOptimize(destination.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+template <typename T>
+void benchmark_parallel_transpose(benchmark::State& state) {
+  const auto n = static_cast<std::size_t>(state.range(0));
+  const auto source = make_matrix<T>(n);
+  auto destination = matrix<T>(n, n);
+
+  for (auto _ : state) {
+    matrix_views::parallel::parallel_transpose(source, destination);
+    benchmark::DoNotOptimize(destination.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+template <typename T>
+void benchmark_in_place(benchmark::State& state) {
+  const auto n = static_cast<std::size_t>(state.range(0));
+  auto m = make_matrix<T>(n);
+
+  for (auto _ : state) {
+    matrix_views::kernels::transpose_in_place(m);
+    benchmark::DoNotOptimize(m.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+/*
+ * In-place transpose of the n x n / 2 matrix, which follows the cycles of
+ * the permutation
+ */
+template <typename T>
+void benchmark_in_place_rectangular(benchmark::State& state) {
+  const auto n = static_cast<std::size_t>(state.range(0));
+  auto m = make_matrix<T>(n);
+  const auto values = std::span(m.data(), m.size() / 2);
+
+  auto rows = n / 2, columns = n;
+  for (auto _ : state) {
+    matrix_views::kernels::transpose_in_place(values, rows, columns);
+    std::swap(rows, columns);
+    benchmark::DoNotOptimize(m.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+const bool kRegistered = [] {
+  for (const auto n : kSizes) {
+    benchmark::RegisterBenchmark("transpose_float/naive",
+                                 benchmark_naive<float>)
+        ->Arg(n);
+    benchmark::RegisterBenchmark("transpose_float/recursive",
+                                 benchmark_transpose<float>)
+        ->Arg(n);
+    benchmark::RegisterBenchmark("transpose_double/naive",
+                                 benchmark_naive<double>)
+        ->Arg(n);
+    benchmark::RegisterBenchmark("transpose_double/recursive",
+                                 benchmark_transpose<double>)
+        ->Arg(n);
+    benchmark::RegisterBenchmark("transpose_double/parallel",
+                                 benchmark_parallel_transpose<double>)
+        ->Arg(n);
+    benchmark::RegisterBenchmark("transpose_double/in_place",
+                                 benchmark_in_place<double>)
+        ->Arg(n);
+    benchmark::RegisterBenchmark("transpose_double/in_place_rectangular",
+                                 benchmark_in_place_rectangular<double>)
+        ->Arg(n);
+  }
+  return true;
+}();
+
+}  // namespace
+
+}  // namespace benchmarks
@@ -0,0 +1,86 @@
+#include <benchmark/benchmark.h>
+
+#include <numeric>
+
+#include "matrices/adaptive_matrix.hpp"
+#include "matrices/matrix.hpp"
+
+namespace benchmarks {
+
+using namespace matrix_views::matrices;
+using namespace matrix_views::utils;
+
+namespace {
+
+/*
+ * Square matrix sizes and the number of sweeps of a phase. Every iteration
+ * runs a phase of row sweeps followed by a phase of column sweeps
+ */
+constexpr std::int64_t kSizes[] = {512, 2048};
+constexpr std::size_t kPhaseSweeps = 8;
+
+matrix<double> make_matrix(std::size_t n) {
+  auto m = matrix<double>(n, n);
+  std::iota(m.data(), m.data() + m.size(), 0.);
+  return m;
+}
+
+/*
+ * Sum of all stripes in the direction of the tag
+ */
+template <typename Tag>
+double stripes_sum(const auto& m) {
+  double total = 0;
+  for (const auto stripe : m.stripes(Tag{})) {
+    total = std::accumulate(stripe.begin(), stripe.end(), total);
+  }
+  return total;
+}
+
+void benchmark_fixed(benchmark::State& state) {
+  const auto n = static_cast<std::size_t>(state.range(0));
+  const auto m = make_matrix(n);
+
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < kPhaseSweeps; ++i) {
+      benchmark::DoNotOptimize(stripes_sum<kRowTag>(m));
+    }
+    for (std::size_t i = 0; i < kPhaseSweeps; ++i) {
+      benchmark::DoNotOptimize(stripes_sum<kColumnTag>(m));
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * 2 * kPhaseSweeps * n * n);
+}
+
+/*
+ * Takes a snapshot per sweep, so sweeps after a relayout see the new layout
+ */
+void benchmark_adaptive(benchmark::State& state) {
+  const auto n = static_cast<std::size_t>(state.range(0));
+  const auto m = adaptive_matrix<double>(make_matrix(n));
+
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < kPhaseSweeps; ++i) {
+      benchmark::DoNotOptimize(stripes_sum<kRowTag>(m.take_snapshot()));
+    }
+    for (std::size_t i = 0; i < kPhaseSweeps; ++i) {
+      benchmark::DoNotOptimize(stripes_sum<kColumnTag>(m.take_snapshot()));
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * 2 * kPhaseSweeps * n * n);
+}
+
+const bool kRegistered = [] {
+  for (const auto n : kSizes) {
+    benchmark::RegisterBenchmark("phases/fixed", benchmark_fixed)->Arg(n);
+    benchmark::RegisterBenchmark("phases/adaptive", benchmark_adaptive)
+        ->Arg(n);
+  }
+  return true;
+}();
+
+}  // namespace
+
+}  // namespace benchmarks
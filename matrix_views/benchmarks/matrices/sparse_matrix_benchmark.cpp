@@ -0,0 +1,153 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "matrices/sparse_matrix.hpp"
+
+namespace benchmarks {
+
+using namespace matrix_views::matrices;
+using namespace matrix_views::utils;
+using matrix_views::utils::index;
+
+namespace {
+
+/*
+ * Square matrix sizes and the share of nonzeros
+ */
+constexpr std::int64_t kSizes[] = {4096, 16384};
+constexpr double kDensity = 0.001;
+
+/*
+ * Dense views binary search every cell, so they run on small matrices only
+ */
+constexpr std::int64_t kMaxDenseViewSize = 4096;
+
+/*
+ * Random n x n matrix with about kDensity * n nonzeros per major stripe
+ */
+template <typename Layout>
+sparse_matrix<double, Layout> make_sparse_matrix(std::size_t n) {
+  auto engine = std::mt19937(42);
+  auto bernoulli = std::bernoulli_distribution(kDensity);
+
+  std::vector<std::ptrdiff_t> offsets = {0}, indices;
+  std::vector<double> values;
+  for (std::size_t i = 0; i < n; ++i) {
+    for (std::size_t j = 0; j < n; ++j) {
+      if (bernoulli(engine)) {
+        indices.push_back(static_cast<std::ptrdiff_t>(j));
+        values.push_back(static_cast<double>(i + j));
+      }
+    }
+    offsets.push_back(std::ssize(indices));
+  }
+  return sparse_matrix<double, Layout>(n, n, std::move(offsets),
+                                       std::move(indices), std::move(values));
+}
+
+/*
+ * y = A * x over the nonzeros of the rows of a CSR matrix
+ */
+void spmv_sparse(const sparse_matrix<double>& m, const std::vector<double>& x,
+                 std::vector<double>& y) {
+  for (std::ptrdiff_t i = 0; i < std::ssize(y); ++i) {
+    double sum = 0;
+    for (const auto [index, value] : m.nonzeros(kRow, i)) {
+      sum += value * x[index.column];
+    }
+    y[i] = sum;
+  }
+}
+
+/*
+ * y = A * x over the dense views of the rows of a CSR matrix
+ */
+void spmv_dense_view(const sparse_matrix<double>& m,
+                     const std::vector<double>& x, std::vector<double>& y) {
+  for (std::ptrdiff_t i = 0; i < std::ssize(y); ++i) {
+    const auto row = m.row(i);
+    y[i] = std::inner_product(row.begin(), row.end(), x.begin(), 0.);
+  }
+}
+
+void benchmark_spmv(benchmark::State& state, bool sparse) {
+  const auto n = static_cast<std::size_t>(state.range(0));
+  const auto m = make_sparse_matrix<kRowMajorTag>(n);
+  const auto x = std::vector<double>(n, 1.);
+  auto y = std::vector<double>(n);
+
+  for (auto _ : state) {
+    sparse ? spmv_sparse(m, x, y) : spmv_dense_view(m, x, y);
+    benchmark::DoNotOptimize(y.data());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * m.nonzeros_count());
+}
+
+/*
+ * Sums of all stripes in the direction of the tag over the nonzeros of a
+ * matrix compressed in that direction or over the dense views
+ */
+template <typename Tag, typename Layout>
+void benchmark_stripe_sums(benchmark::State& state, bool sparse) {
+  const auto n = static_cast<std::ptrdiff_t>(state.range(0));
+  const auto m = make_sparse_matrix<Layout>(static_cast<std::size_t>(n));
+
+  for (auto _ : state) {
+    double total = 0;
+    for (std::ptrdiff_t i = 0; i < n; ++i) {
+      if (sparse) {
+        for (const auto [index, value] : m.nonzeros(Tag{}, i)) {
+          total += value;
+        }
+      } else if constexpr (std::is_same_v<Tag, kRowTag>) {
+        total += std::accumulate(m.row(i).begin(), m.row(i).end(), 0.);
+      } else {
+        total += std::accumulate(m.column(i).begin(), m.column(i).end(), 0.);
+      }
+    }
+    benchmark::DoNotOptimize(total);
+  }
+
+  state.SetItemsProcessed(state.iterations() * m.nonzeros_count());
+}
+
+const bool kRegistered = [] {
+  for (const auto n : kSizes) {
+    benchmark::RegisterBenchmark("spmv/csr/sparse", benchmark_spmv, true)
+        ->Arg(n);
+    benchmark::RegisterBenchmark(
+        "row_sum/csr/sparse", benchmark_stripe_sums<kRowTag, kRowMajorTag>,
+        true)
+        ->Arg(n);
+    benchmark::RegisterBenchmark(
+        "column_sum/csc/sparse",
+        benchmark_stripe_sums<kColumnTag, kColumnMajorTag>, true)
+        ->Arg(n);
+
+    if (n <= kMaxDenseViewSize) {
+      benchmark::RegisterBenchmark("spmv/csr/dense_view", benchmark_spmv,
+                                   false)
+          ->Arg(n);
+      benchmark::RegisterBenchmark(
+          "row_sum/csr/dense_view",
+          benchmark_stripe_sums<kRowTag, kRowMajorTag>, false)
+          ->Arg(n);
+      benchmark::RegisterBenchmark(
+          "column_sum/csc/dense_view",
+          benchmark_stripe_sums<kColumnTag, kColumnMajorTag>, false)
+          ->Arg(n);
+    }
+  }
+  return true;
+}();
+
+}  // namespace
+
+}  // namespace benchmarks
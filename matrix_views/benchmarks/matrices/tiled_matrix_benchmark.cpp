@@ -0,0 +1,101 @@
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+#include <numeric>
+#include <string>
+
+#include "matrices/matrix.hpp"
+#include "matrices/tiled_matrix.hpp"
+
+namespace benchmarks {
+
+using namespace matrix_views::matrices;
+using namespace matrix_views::utils;
+using matrix_views::utils::index;
+
+namespace {
+
+/*
+ * Square matrix sizes, the tile size and the share of the tiles that fit
+ * into the cache of the tiled matrix
+ */
+constexpr std::int64_t kSizes[] = {1024, 4096};
+constexpr std::size_t kTileSize = 256;
+constexpr std::size_t kCachedTilesDivisor = 4;
+
+matrix<double> make_matrix(std::size_t n) {
+  auto m = matrix<double>(n, n);
+  std::iota(m.data(), m.data() + m.size(), 0.);
+  return m;
+}
+
+/*
+ * Sum of all stripes in the direction of the tag
+ */
+template <typename Tag>
+double stripes_sum(const auto& m) {
+  double total = 0;
+  for (const auto stripe : m.stripes(Tag{})) {
+    total = std::accumulate(stripe.begin(), stripe.end(), total);
+  }
+  return total;
+}
+
+template <typename Tag>
+void benchmark_in_memory(benchmark::State& state) {
+  const auto n = static_cast<std::size_t>(state.range(0));
+  const auto m = make_matrix(n);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(stripes_sum<Tag>(m));
+  }
+
+  state.SetItemsProcessed(state.iterations() * m.size());
+}
+
+/*
+ * The file is likely in the page cache, so this measures the overhead of the
+ * tile cache rather than the disk
+ */
+template <typename Tag>
+void benchmark_tiled(benchmark::State& state) {
+  const auto n = static_cast<std::size_t>(state.range(0));
+  const auto path = std::filesystem::temp_directory_path() /
+                    ("tiled_matrix_benchmark_" + std::to_string(n));
+  tiled_matrix<double>::store(path, make_matrix(n), kTileSize);
+
+  const auto tiles = (n + kTileSize - 1) / kTileSize;
+  const auto m = tiled_matrix<double>(
+      path, n, n, kTileSize,
+      tiles * tiles / kCachedTilesDivisor * kTileSize * kTileSize *
+          sizeof(double));
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(stripes_sum<Tag>(m));
+  }
+
+  state.SetItemsProcessed(state.iterations() * n * n);
+  state.counters["misses"] = static_cast<double>(m.stats().misses);
+  std::filesystem::remove(path);
+}
+
+const bool kRegistered = [] {
+  for (const auto n : kSizes) {
+    benchmark::RegisterBenchmark("row_sweep/in_memory",
+                                 benchmark_in_memory<kRowTag>)
+        ->Arg(n);
+    benchmark::RegisterBenchmark("row_sweep/tiled", benchmark_tiled<kRowTag>)
+        ->Arg(n);
+    benchmark::RegisterBenchmark("column_sweep/in_memory",
+                                 benchmark_in_memory<kColumnTag>)
+        ->Arg(n);
+    benchmark::RegisterBenchmark("column_sweep/tiled",
+                                 benchmark_tiled<kColumnTag>)
+        ->Arg(n);
+  }
+  return true;
+}();
+
+}  // namespace
+
+}  // namespace benchmarks
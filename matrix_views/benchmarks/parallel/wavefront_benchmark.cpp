@@ -0,0 +1,117 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "matrices/matrix.hpp"
+#include "parallel/wavefront.hpp"
+
+namespace benchmarks {
+
+using namespace matrix_views::matrices;
+using namespace matrix_views::parallel;
+using matrix_views::utils::index;
+
+namespace {
+
+/*
+ * Edit distance matrix sizes from L2-resident to larger than the LLC
+ */
+constexpr std::int64_t kSizes[] = {256, 1024, 4096};
+
+/*
+ * Tile sizes of the tiled wavefront, 0 stands for the untiled one
+ */
+constexpr std::size_t kTileSizes[] = {0, 32, 128};
+
+std::string make_string(std::size_t size, unsigned seed) {
+  auto engine = std::mt19937(seed);
+  auto distribution = std::uniform_int_distribution<int>('a', 'd');
+
+  auto string = std::string(size, '\0');
+  std::ranges::generate(string, [&] {
+    return static_cast<char>(distribution(engine));
+  });
+  return string;
+}
+
+/*
+ * Edit distance cell update. The first row and column hold the distances to
+ * the empty string
+ */
+struct edit_distance final {
+  matrix<int>& m;
+  const std::string& lhs;
+  const std::string& rhs;
+
+  void operator()(index index) const {
+    const auto [i, j] = index;
+    if (i == 0 || j == 0) {
+      m(index) = static_cast<int>(i + j);
+      return;
+    }
+    m(index) = std::min({m({i - 1, j}) + 1, m({i, j - 1}) + 1,
+                         m({i - 1, j - 1}) + (lhs[i - 1] != rhs[j - 1])});
+  }
+};
+
+/*
+ * Baseline serial row-major fill
+ */
+void benchmark_serial(benchmark::State& state) {
+  const auto n = static_cast<std::size_t>(state.range(0));
+  const auto lhs = make_string(n - 1, 1), rhs = make_string(n - 1, 2);
+  auto m = matrix<int>(n, n);
+  const auto update = edit_distance{m, lhs, rhs};
+  const auto last = static_cast<std::ptrdiff_t>(n) - 1;
+
+  for (auto _ : state) {
+    for (std::ptrdiff_t i = 0; i <= last; ++i) {
+      for (std::ptrdiff_t j = 0; j <= last; ++j) {
+        update({i, j});
+      }
+    }
+    benchmark::DoNotOptimize(m({last, last}));
+  }
+
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+void benchmark_wavefront(benchmark::State& state, std::size_t tile_size) {
+  const auto n = static_cast<std::size_t>(state.range(0));
+  const auto lhs = make_string(n - 1, 1), rhs = make_string(n - 1, 2);
+  auto m = matrix<int>(n, n);
+  const auto update = edit_distance{m, lhs, rhs};
+  const auto last = static_cast<std::ptrdiff_t>(n) - 1;
+
+  for (auto _ : state) {
+    parallel_wavefront(n, n, update, tile_size);
+    benchmark::DoNotOptimize(m({last, last}));
+  }
+
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+const bool kRegistered = [] {
+  for (const auto n : kSizes) {
+    benchmark::RegisterBenchmark("edit_distance/serial", benchmark_serial)
+        ->Arg(n);
+    for (const auto tile_size : kTileSizes) {
+      const auto name =
+          tile_size == 0
+              ? std::string("edit_distance/wavefront")
+              : "edit_distance/tiled_wavefront_" + std::to_string(tile_size);
+      benchmark::RegisterBenchmark(name.c_str(), benchmark_wavefront,
+                                   tile_size)
+          ->Arg(n)
+          ->UseRealTime();
+    }
+  }
+  return true;
+}();
+
+}  // namespace
+
+}  // namespace benchmarks
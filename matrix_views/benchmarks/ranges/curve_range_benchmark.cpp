@@ -0,0 +1,114 @@
+#include <benchmark/benchmark.h>
+
+#include <numeric>
+#include <vector>
+
+#include "matrices/matrix.hpp"
+#include "matrices/matrix_view.hpp"
+#include "storage/morton_storage_proxy.hpp"
+
+namespace benchmarks {
+
+using namespace matrix_views::matrices;
+using namespace matrix_views::storage;
+using namespace matrix_views::utils;
+
+namespace {
+
+/*
+ * Square matrix sizes from L2-resident to larger than the LLC
+ */
+constexpr std::int64_t kSizes[] = {256, 1024, 4096};
+
+matrix<float> make_matrix(std::size_t n) {
+  auto m = matrix<float>(n, n);
+  std::iota(m.data(), m.data() + m.size(), 0.f);
+  return m;
+}
+
+/*
+ * Sums a row-major matrix stripe by stripe in the direction of the tag
+ */
+template <typename Tag>
+void benchmark_stripes(benchmark::State& state) {
+  const auto m = make_matrix(static_cast<std::size_t>(state.range(0)));
+
+  for (auto _ : state) {
+    for (const auto stripe : m.stripes(Tag{})) {
+      benchmark::DoNotOptimize(
+          std::accumulate(stripe.begin(), stripe.end(), 0.f));
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * m.size());
+}
+
+/*
+ * Sums a row-major matrix along a space-filling curve
+ */
+template <typename Tag>
+void benchmark_curve(benchmark::State& state) {
+  const auto m = make_matrix(static_cast<std::size_t>(state.range(0)));
+
+  for (auto _ : state) {
+    const auto range = m.cells(Tag{});
+    benchmark::DoNotOptimize(std::accumulate(range.begin(), range.end(), 0.f));
+  }
+
+  state.SetItemsProcessed(state.iterations() * m.size());
+}
+
+/*
+ * Sums a matrix stored in Z-order, along the Z-order curve or by columns
+ */
+template <typename Tag>
+void benchmark_morton_storage(benchmark::State& state) {
+  const auto n = static_cast<std::size_t>(state.range(0));
+  auto data = std::vector<float>(morton_storage_proxy<float>::size(n, n));
+  std::iota(data.begin(), data.end(), 0.f);
+  const auto m =
+      matrix_view(morton_storage_proxy<const float>(data.data(), n, n), n, n);
+
+  for (auto _ : state) {
+    if constexpr (std::is_same_v<Tag, kMortonTag>) {
+      const auto range = m.cells(Tag{});
+      benchmark::DoNotOptimize(
+          std::accumulate(range.begin(), range.end(), 0.f));
+    } else {
+      for (const auto stripe : m.stripes(Tag{})) {
+        benchmark::DoNotOptimize(
+            std::accumulate(stripe.begin(), stripe.end(), 0.f));
+      }
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<long>(n * n));
+}
+
+const bool kRegistered = [] {
+  for (const auto n : kSizes) {
+    benchmark::RegisterBenchmark("sum/row_major/rows",
+                                 benchmark_stripes<kRowTag>)
+        ->Arg(n);
+    benchmark::RegisterBenchmark("sum/row_major/columns",
+                                 benchmark_stripes<kColumnTag>)
+        ->Arg(n);
+    benchmark::RegisterBenchmark("sum/row_major/morton",
+                                 benchmark_curve<kMortonTag>)
+        ->Arg(n);
+    benchmark::RegisterBenchmark("sum/row_major/hilbert",
+                                 benchmark_curve<kHilbertTag>)
+        ->Arg(n);
+    benchmark::RegisterBenchmark("sum/morton_storage/morton",
+                                 benchmark_morton_storage<kMortonTag>)
+        ->Arg(n);
+    benchmark::RegisterBenchmark("sum/morton_storage/columns",
+                                 benchmark_morton_storage<kColumnTag>)
+        ->Arg(n);
+  }
+  return true;
+}();
+
+}  // namespace
+
+}  // namespace benchmarks
@@ -0,0 +1,86 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "matrices/matrix.hpp"
+#include "ranges/expression.hpp"
+
+namespace benchmarks {
+
+using namespace matrix_views::matrices;
+using namespace matrix_views::ranges;
+using namespace matrix_views::utils;
+using matrix_views::utils::index;
+
+namespace {
+
+/*
+ * Square matrix sizes from L1-resident to larger than the LLC
+ */
+constexpr std::int64_t kSizes[] = {64, 256, 1024, 4096};
+constexpr double kAlpha = 0.5;
+
+matrix<double> make_matrix(std::size_t n) {
+  auto m = matrix<double>(n, n);
+  std::iota(m.data(), m.data() + m.size(), 0.);
+  return m;
+}
+
+/*
+ * y.row(i) = alpha * x.row(i) + y.row(i) with a lazy expression per row
+ */
+void benchmark_axpy_fused(benchmark::State& state) {
+  const auto n = static_cast<std::size_t>(state.range(0));
+  const auto x = make_matrix(n);
+  auto y = make_matrix(n);
+
+  for (auto _ : state) {
+    for (std::ptrdiff_t i = 0; i < static_cast<std::ptrdiff_t>(n); ++i) {
+      std::ranges::copy(x.row(i) * kAlpha + y.row(i), y.row(i).begin());
+    }
+    benchmark::DoNotOptimize(y.data());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+/*
+ * The same with alpha * x.row(i) materialized into a temporary first. The
+ * temporary is allocated once outside of the timed loop
+ */
+void benchmark_axpy_two_pass(benchmark::State& state) {
+  const auto n = static_cast<std::size_t>(state.range(0));
+  const auto x = make_matrix(n);
+  auto y = make_matrix(n);
+
+  auto scaled = std::vector<double>(n);
+
+  for (auto _ : state) {
+    for (std::ptrdiff_t i = 0; i < static_cast<std::ptrdiff_t>(n); ++i) {
+      std::ranges::transform(x.row(i), scaled.begin(),
+                             [](double value) { return kAlpha * value; });
+      std::ranges::transform(scaled, y.row(i), y.row(i).begin(),
+                             std::plus<>());
+    }
+    benchmark::DoNotOptimize(y.data());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+const bool kRegistered = [] {
+  for (const auto n : kSizes) {
+    benchmark::RegisterBenchmark("axpy/fused", benchmark_axpy_fused)->Arg(n);
+    benchmark::RegisterBenchmark("axpy/two_pass", benchmark_axpy_two_pass)
+        ->Arg(n);
+  }
+  return true;
+}();
+
+}  // namespace
+
+}  // namespace benchmarks
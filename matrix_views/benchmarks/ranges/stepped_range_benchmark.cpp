@@ -0,0 +1,95 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "matrices/matrix.hpp"
+#include "ranges/tagged_random_access_range.hpp"
+
+namespace benchmarks {
+
+using namespace matrix_views::matrices;
+using namespace matrix_views::ranges;
+using namespace matrix_views::utils;
+using matrix_views::utils::index;
+
+namespace {
+
+/*
+ * Square matrix sizes from L1-resident to larger than the LLC
+ */
+constexpr std::int64_t kSizes[] = {64, 256, 1024, 4096};
+constexpr std::ptrdiff_t kStep = 4;
+
+matrix<float> make_matrix(std::size_t n) {
+  auto m = matrix<float>(n, n);
+  std::iota(m.data(), m.data() + m.size(), 0.f);
+  return m;
+}
+
+/*
+ * Sums every kStep-th element of every column. The loop advances by whole
+ * steps clamped to the end of the range, which is what std::views::stride
+ * does on top of the tagged iterators
+ */
+void benchmark_clamped_advance(benchmark::State& state) {
+  const auto m = make_matrix(static_cast<std::size_t>(state.range(0)));
+
+  for (auto _ : state) {
+    for (const auto column : columns(m)) {
+      auto accumulator = 0.f;
+      const auto end = column.end();
+      for (auto it = column.begin(); it != end;
+           it += std::min(kStep, end - it)) {
+        accumulator += *it;
+      }
+      benchmark::DoNotOptimize(accumulator);
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * m.size() / kStep);
+}
+
+/*
+ * The same over columns with the step set in the type or passed at runtime
+ */
+template <std::size_t Step>
+void benchmark_stepped(benchmark::State& state) {
+  const auto m = make_matrix(static_cast<std::size_t>(state.range(0)));
+
+  for (auto _ : state) {
+    for (const auto column : columns(m)) {
+      const auto stepped = [&] {
+        if constexpr (Step == std::dynamic_extent) {
+          return stride(column, kStep);
+        } else {
+          return stride<Step>(column);
+        }
+      }();
+      benchmark::DoNotOptimize(
+          std::accumulate(stepped.begin(), stepped.end(), 0.f));
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * m.size() / kStep);
+}
+
+const bool kRegistered = [] {
+  for (const auto n : kSizes) {
+    benchmark::RegisterBenchmark("column_sum/clamped_advance",
+                                 benchmark_clamped_advance)
+        ->Arg(n);
+    benchmark::RegisterBenchmark("column_sum/stepped_static",
+                                 benchmark_stepped<kStep>)
+        ->Arg(n);
+    benchmark::RegisterBenchmark("column_sum/stepped_dynamic",
+                                 benchmark_stepped<std::dynamic_extent>)
+        ->Arg(n);
+  }
+  return true;
+}();
+
+}  // namespace
+
+}  // namespace benchmarks
@@ -0,0 +1,338 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <numeric>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "kernels/reduce.hpp"
+#include "kernels/transform.hpp"
+#include "ranges/tagged_random_access_range.hpp"
+#include "storage/callable_storage_proxy.hpp"
+#include "storage/strided_storage_proxy.hpp"
+
+namespace benchmarks {
+
+using namespace matrix_views::ranges;
+using namespace matrix_views::storage;
+using namespace matrix_views::utils;
+using matrix_views::utils::index;
+
+namespace {
+
+/*
+ * Square matrix sizes from L1-resident to larger than the LLC
+ */
+using sizes_t = std::integer_sequence<std::size_t, 64, 256, 1024, 4096>;
+
+template <typename... Ts>
+struct type_list final {};
+
+template <typename... Ts>
+constexpr void for_each_type(type_list<Ts...>, auto&& f) {
+  (f.template operator()<Ts>(), ...);
+}
+
+template <std::size_t... Ns>
+constexpr void for_each_size(std::integer_sequence<std::size_t, Ns...>,
+                             auto&& f) {
+  (f.template operator()<Ns>(), ...);
+}
+
+template <typename T>
+constexpr const char* kName = nullptr;
+template <>
+constexpr const char* kName<int> = "int";
+template <>
+constexpr const char* kName<float> = "float";
+template <>
+constexpr const char* kName<double> = "double";
+template <>
+constexpr const char* kName<kRowTag> = "row";
+template <>
+constexpr const char* kName<kColumnTag> = "column";
+template <>
+constexpr const char* kName<kDiagonalTag> = "diagonal";
+template <>
+constexpr const char* kName<kAntidiagonalTag> = "antidiagonal";
+
+/*
+ * Calls f(start, size) for every stripe of an n x n matrix in the direction
+ * of the tag
+ */
+template <typename Tag>
+constexpr void for_each_stripe(Tag, std::ptrdiff_t n, auto&& f) {
+  if constexpr (std::is_same_v<Tag, kRowTag>) {
+    for (std::ptrdiff_t i = 0; i < n; ++i) f(index{i, 0}, n);
+  } else if constexpr (std::is_same_v<Tag, kColumnTag>) {
+    for (std::ptrdiff_t j = 0; j < n; ++j) f(index{0, j}, n);
+  } else if constexpr (std::is_same_v<Tag, kDiagonalTag>) {
+    for (std::ptrdiff_t j = 0; j < n; ++j) f(index{0, j}, n - j);
+    for (std::ptrdiff_t i = 1; i < n; ++i) f(index{i, 0}, n - i);
+  } else {
+    static_assert(std::is_same_v<Tag, kAntidiagonalTag>);
+    for (std::ptrdiff_t j = 0; j < n; ++j) f(index{0, j}, j + 1);
+    for (std::ptrdiff_t i = 1; i < n; ++i) f(index{i, n - 1}, n - i);
+  }
+}
+
+/*
+ * Hand-written baseline stripe: a pointer, a length and a step
+ */
+template <typename T>
+struct raw_stripe final {
+  T* data;
+  std::ptrdiff_t size;
+  std::ptrdiff_t stride;
+};
+
+struct sum final {
+  static constexpr const char* kName = "sum";
+
+  template <typename T>
+  void operator()(raw_stripe<const T> source, raw_stripe<T>) const {
+    T accumulator = T();
+    for (std::ptrdiff_t k = 0; k < source.size; ++k) {
+      accumulator += source.data[k * source.stride];
+    }
+    benchmark::DoNotOptimize(accumulator);
+  }
+
+  void operator()(const auto& source, const auto&) const {
+    using value_type = std::ranges::range_value_t<decltype(source)>;
+    benchmark::DoNotOptimize(
+        std::accumulate(source.begin(), source.end(), value_type()));
+  }
+};
+
+struct copy final {
+  static constexpr const char* kName = "copy";
+
+  template <typename T>
+  void operator()(raw_stripe<const T> source,
+                  raw_stripe<T> destination) const {
+    for (std::ptrdiff_t k = 0; k < source.size; ++k) {
+      destination.data[k * destination.stride] = source.data[k * source.stride];
+    }
+  }
+
+  void operator()(const auto& source, const auto& destination) const {
+    std::ranges::copy(source, destination.begin());
+  }
+};
+
+struct transform final {
+  static constexpr const char* kName = "transform";
+
+  static constexpr auto kFunction = [](auto value) {
+    return value * decltype(value)(2) + decltype(value)(1);
+  };
+
+  template <typename T>
+  void operator()(raw_stripe<const T> source,
+                  raw_stripe<T> destination) const {
+    for (std::ptrdiff_t k = 0; k < source.size; ++k) {
+      destination.data[k * destination.stride] =
+          kFunction(source.data[k * source.stride]);
+    }
+  }
+
+  void operator()(const auto& source, const auto& destination) const {
+    std::ranges::transform(source, destination.begin(), kFunction);
+  }
+};
+
+struct find final {
+  static constexpr const char* kName = "find";
+
+  template <typename T>
+  void operator()(raw_stripe<const T> source, raw_stripe<T>) const {
+    std::ptrdiff_t k = 0;
+    for (; k < source.size; ++k) {
+      if (source.data[k * source.stride] == T(-1)) {
+        break;
+      }
+    }
+    benchmark::DoNotOptimize(k);
+  }
+
+  void operator()(const auto& source, const auto&) const {
+    using value_type = std::ranges::range_value_t<decltype(source)>;
+    benchmark::DoNotOptimize(std::ranges::find(source, value_type(-1)));
+  }
+};
+
+/*
+ * sum and transform over the vectorized kernels. Baselines are the same as
+ * for the standard algorithms
+ */
+struct kernel_sum final {
+  static constexpr const char* kName = "kernel_sum";
+
+  template <typename T>
+  void operator()(raw_stripe<const T> source,
+                  raw_stripe<T> destination) const {
+    sum()(source, destination);
+  }
+
+  void operator()(const auto& source, const auto&) const {
+    benchmark::DoNotOptimize(matrix_views::kernels::sum(source));
+  }
+};
+
+struct kernel_transform final {
+  static constexpr const char* kName = "kernel_transform";
+
+  template <typename T>
+  void operator()(raw_stripe<const T> source,
+                  raw_stripe<T> destination) const {
+    transform()(source, destination);
+  }
+
+  void operator()(const auto& source, const auto& destination) const {
+    matrix_views::kernels::transform(source, destination, transform::kFunction);
+  }
+};
+
+/*
+ * Baseline traversal over raw pointers
+ */
+struct raw_traversal final {
+  static constexpr const char* kName = "raw";
+  static constexpr std::size_t kExtent = std::dynamic_extent;
+
+  template <typename Tag, typename T>
+  static void run(Tag tag, const T* source, T* destination, std::ptrdiff_t n,
+                  auto&& operation) {
+    const std::ptrdiff_t stride = std::is_same_v<Tag, kRowTag>      ? 1
+                                  : std::is_same_v<Tag, kColumnTag> ? n
+                                  : std::is_same_v<Tag, kDiagonalTag>
+                                      ? n + 1
+                                      : n - 1;
+    for_each_stripe(tag, n, [&](index start, std::ptrdiff_t size) {
+      const auto offset = start.row * n + start.column;
+      operation(raw_stripe<const T>{source + offset, size, stride},
+                raw_stripe<T>{destination + offset, size, stride});
+    });
+  }
+};
+
+/*
+ * Traversal over tagged ranges backed by callable_storage_proxy
+ */
+template <std::size_t Extent>
+struct callable_traversal final {
+  static constexpr const char* kName =
+      Extent == std::dynamic_extent ? "callable_dynamic" : "callable_static";
+  static constexpr std::size_t kExtent = Extent;
+
+  template <typename T>
+  static constexpr auto make_storage_proxy(T* data, std::ptrdiff_t n) {
+    if constexpr (Extent == std::dynamic_extent) {
+      return callable_storage_proxy([data, n](index index) -> T& {
+        return data[index.row * n + index.column];
+      });
+    } else {
+      return callable_storage_proxy([data](index index) -> T& {
+        return data[index.row * static_cast<std::ptrdiff_t>(Extent) +
+                    index.column];
+      });
+    }
+  }
+
+  template <typename Tag, typename T>
+  static void run(Tag tag, const T* source, T* destination, std::ptrdiff_t n,
+                  auto&& operation) {
+    const auto source_proxy = make_storage_proxy(source, n);
+    const auto destination_proxy = make_storage_proxy(destination, n);
+    for_each_stripe(tag, n, [&](index start, std::ptrdiff_t) {
+      operation(
+          tagged_random_access_range<Tag, decltype(source_proxy), Extent,
+                                     Extent>(tag, start, source_proxy, n, n),
+          tagged_random_access_range<Tag, decltype(destination_proxy), Extent,
+                                     Extent>(tag, start, destination_proxy, n,
+                                             n));
+    });
+  }
+};
+
+/*
+ * Traversal over tagged ranges backed by a row-major strided_storage_proxy
+ */
+template <std::size_t Extent>
+struct strided_traversal final {
+  static constexpr const char* kName =
+      Extent == std::dynamic_extent ? "strided_dynamic" : "strided_static";
+  static constexpr std::size_t kExtent = Extent;
+
+  template <typename Tag, typename T>
+  static void run(Tag tag, const T* source, T* destination, std::ptrdiff_t n,
+                  auto&& operation) {
+    // Proxy types must not be const for the iterators to advance the pointer
+    using source_proxy_t = strided_storage_proxy<const T, Extent, 1>;
+    using destination_proxy_t = strided_storage_proxy<T, Extent, 1>;
+
+    const auto source_proxy = source_proxy_t(source, n);
+    const auto destination_proxy = destination_proxy_t(destination, n);
+    for_each_stripe(tag, n, [&](index start, std::ptrdiff_t) {
+      operation(
+          tagged_random_access_range<Tag, source_proxy_t, Extent, Extent>(
+              tag, start, source_proxy, n, n),
+          tagged_random_access_range<Tag, destination_proxy_t, Extent, Extent>(
+              tag, start, destination_proxy, n, n));
+    });
+  }
+};
+
+template <typename Operation, typename Tag, typename T, typename Traversal>
+void benchmark_traversal(benchmark::State& state) {
+  const auto n = static_cast<std::ptrdiff_t>(state.range(0));
+  std::vector<T> source(n * n), destination(n * n);
+  std::iota(source.begin(), source.end(), T(0));
+
+  for (auto _ : state) {
+    Traversal::run(Tag{}, source.data(), destination.data(), n, Operation{});
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * n * n);
+  state.SetBytesProcessed(state.iterations() * n * n * sizeof(T));
+}
+
+template <typename Operation, typename Tag, typename T, typename Traversal>
+void register_benchmark(std::size_t n) {
+  const auto name = std::string(Operation::kName) + "/" + kName<Tag> + "/" +
+                    kName<T> + "/" + Traversal::kName;
+  benchmark::RegisterBenchmark(
+      name.c_str(), benchmark_traversal<Operation, Tag, T, Traversal>)
+      ->Arg(static_cast<std::int64_t>(n));
+}
+
+const bool kRegistered = [] {
+  using operations_t = type_list<sum, copy, transform, find, kernel_sum,
+                                 kernel_transform>;
+  using tags_t = type_list<kRowTag, kColumnTag, kDiagonalTag, kAntidiagonalTag>;
+  using types_t = type_list<float, double, int>;
+
+  for_each_type(operations_t(), []<typename Operation>() {
+    for_each_type(tags_t(), []<typename Tag>() {
+      for_each_type(types_t(), []<typename T>() {
+        for_each_size(sizes_t(), []<std::size_t N>() {
+          register_benchmark<Operation, Tag, T, raw_traversal>(N);
+          register_benchmark<Operation, Tag, T,
+                             callable_traversal<std::dynamic_extent>>(N);
+          register_benchmark<Operation, Tag, T, callable_traversal<N>>(N);
+          register_benchmark<Operation, Tag, T,
+                             strided_traversal<std::dynamic_extent>>(N);
+          register_benchmark<Operation, Tag, T, strided_traversal<N>>(N);
+        });
+      });
+    });
+  });
+  return true;
+}();
+
+}  // namespace
+
+}  // namespace benchmarks
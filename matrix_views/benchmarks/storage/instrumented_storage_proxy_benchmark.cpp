@@ -0,0 +1,79 @@
+#include <benchmark/benchmark.h>
+
+#include <numeric>
+
+#include "matrices/matrix.hpp"
+#include "matrices/matrix_view.hpp"
+#include "storage/const_callable_storage_proxy.hpp"
+#include "storage/instrumented_storage_proxy.hpp"
+
+namespace benchmarks {
+
+using namespace matrix_views::matrices;
+using namespace matrix_views::storage;
+using namespace matrix_views::utils;
+using matrix_views::utils::index;
+
+namespace {
+
+constexpr std::int64_t kSizes[] = {64, 1024};
+
+struct site final {};
+
+/*
+ * Sums all rows of a view over a callable proxy, either as is or wrapped into
+ * an instrumented proxy that is disabled, enabled or enabled with timing
+ */
+template <typename Wrap>
+void benchmark_rows(benchmark::State& state) {
+  const auto n = static_cast<std::size_t>(state.range(0));
+  const auto view = matrix_view(
+      Wrap()(const_callable_storage_proxy([n](index index) {
+        return static_cast<float>(index.row * static_cast<std::ptrdiff_t>(n) +
+                                  index.column);
+      })),
+      n, n);
+
+  for (auto _ : state) {
+    for (const auto row : rows(view)) {
+      benchmark::DoNotOptimize(std::accumulate(row.begin(), row.end(), 0.f));
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<long>(n * n));
+  access_profiler<site>::reset();
+}
+
+struct plain final {
+  constexpr auto operator()(auto storage_proxy) const {
+    return storage_proxy;
+  }
+};
+
+template <bool Timing, bool Enabled>
+struct instrument final {
+  constexpr auto operator()(auto storage_proxy) const {
+    return instrumented<site, Timing, Enabled>(storage_proxy);
+  }
+};
+
+const bool kRegistered = [] {
+  for (const auto n : kSizes) {
+    benchmark::RegisterBenchmark("row_sum/plain", benchmark_rows<plain>)
+        ->Arg(n);
+    benchmark::RegisterBenchmark("row_sum/instrumented_disabled",
+                                 benchmark_rows<instrument<false, false>>)
+        ->Arg(n);
+    benchmark::RegisterBenchmark("row_sum/instrumented",
+                                 benchmark_rows<instrument<false, true>>)
+        ->Arg(n);
+    benchmark::RegisterBenchmark("row_sum/instrumented_timed",
+                                 benchmark_rows<instrument<true, true>>)
+        ->Arg(n);
+  }
+  return true;
+}();
+
+}  // namespace
+
+}  // namespace benchmarks
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <iterator>
 
 #include "utils/index.hpp"
@@ -25,9 +26,10 @@ concept base_random_access_iterator_crtp = requires(
  * derived types
  *
  * Implements most of the std::random_access_iterator interface except for
- * indexing and dereferencing parts
+ * indexing and dereferencing parts. The index components are of the Index
+ * type, while distances are always std::ptrdiff_t
  */
-template <typename CRTP>
+template <typename CRTP, utils::index_integral Index = std::ptrdiff_t>
 class base_random_access_iterator {
  protected:
   constexpr base_random_access_iterator() noexcept {
@@ -36,7 +38,8 @@ class base_random_access_iterator {
                   "implement the base_random_access_iterator_crtp concept");
   }
 
-  constexpr base_random_access_iterator(utils::index index) noexcept
+  constexpr base_random_access_iterator(
+      utils::basic_index<Index> index) noexcept
       : base_random_access_iterator() {
     index_ = index;
   }
@@ -48,7 +51,7 @@ class base_random_access_iterator {
   }
 
  protected:
-  utils::index index_;
+  utils::basic_index<Index> index_;
 
  public:
   using iterator_category = std::random_access_iterator_tag;
@@ -95,23 +98,28 @@ class base_random_access_iterator {
     return *crtp_cast() += -n;
   }
 
-  constexpr decltype(auto) operator->() const { return &((*this)[0]); }
+  constexpr decltype(auto) operator->() const
+    requires std::is_lvalue_reference_v<std::iter_reference_t<CRTP>>
+  {
+    return &((*this)[0]);
+  }
   constexpr decltype(auto) operator[](difference_type n) const {
     return *(*this + n);
   }
 };
 
-template <base_random_access_iterator_crtp CRTP>
+template <base_random_access_iterator_crtp CRTP, typename Index>
 constexpr CRTP operator-(
-    const base_random_access_iterator<CRTP>& that,
-    typename base_random_access_iterator<CRTP>::difference_type n) noexcept {
+    const base_random_access_iterator<CRTP, Index>& that,
+    typename base_random_access_iterator<CRTP, Index>::difference_type
+        n) noexcept {
   return that + -n;
 }
 
-template <base_random_access_iterator_crtp CRTP>
+template <base_random_access_iterator_crtp CRTP, typename Index>
 constexpr CRTP operator+(
-    typename base_random_access_iterator<CRTP>::difference_type n,
-    const base_random_access_iterator<CRTP>& that) noexcept {
+    typename base_random_access_iterator<CRTP, Index>::difference_type n,
+    const base_random_access_iterator<CRTP, Index>& that) noexcept {
   return that + n;
 }
 
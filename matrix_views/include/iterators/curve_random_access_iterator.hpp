@@ -0,0 +1,171 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+
+#include "iterators/base_random_access_iterator.hpp"
+#include "iterators/tagged_random_access_iterator.hpp"
+#include "utils/index.hpp"
+#include "utils/space_filling_curves.hpp"
+#include "utils/tags.hpp"
+
+namespace matrix_views::iterators {
+
+/*
+ * Concept representing the set of valid tags for curve_random_access_iterator
+ */
+template <typename Tag>
+concept curve_random_access_iterator_tag =
+    std::same_as<Tag, utils::kMortonTag> ||
+    std::same_as<Tag, utils::kHilbertTag>;
+
+/*
+ * Iterator over all cells of a matrix along a space-filling curve, so that
+ * cells visited one after another are close to each other in both
+ * directions
+ *
+ * The curve runs through the aligned square of side 2^order covering the
+ * matrix and the cells outside of the matrix are skipped. Both curves visit
+ * aligned squares of side 2^t as runs of 4^t positions, so the skipped cells
+ * are passed over in whole squares and any element is found in O(order) steps
+ *
+ * Storage proxies laid out in Z-order may implement at(position) to be
+ * accessed by the Morton code directly
+ */
+template <curve_random_access_iterator_tag Tag,
+          tagged_random_access_iterator_storage_proxy StorageProxy>
+class curve_random_access_iterator final
+    : public base_random_access_iterator<
+          curve_random_access_iterator<Tag, StorageProxy>>,
+      public StorageProxy {
+ private:
+  static inline const constinit bool kMortonTag =
+      std::is_same_v<Tag, utils::kMortonTag>;
+
+  using difference_type = base_random_access_iterator<
+      curve_random_access_iterator>::difference_type;
+  using reference = typename StorageProxy::reference;
+
+ public:
+  constexpr curve_random_access_iterator() noexcept = default;
+
+  /*
+   * The index holds the number of the element, i.e. {n, 0} is the n-th cell
+   * of the matrix along the curve and {rows * columns, 0} is the end
+   */
+  constexpr curve_random_access_iterator(Tag, utils::index index,
+                                         StorageProxy storage_proxy,
+                                         std::size_t rows,
+                                         std::size_t columns) noexcept
+      : base_random_access_iterator<curve_random_access_iterator>(index),
+        StorageProxy(std::move(storage_proxy)),
+        rows_(static_cast<std::ptrdiff_t>(rows)),
+        columns_(static_cast<std::ptrdiff_t>(columns)),
+        order_(utils::curve_order(rows, columns)) {
+    seek();
+  }
+
+ public:
+  constexpr curve_random_access_iterator& operator+=(
+      difference_type n) noexcept {
+    this->index_.row += n;
+    if (n == 1 && this->index_.row < rows_ * columns_) {
+      ++position_;
+      skip();
+    } else {
+      seek();
+    }
+    return *this;
+  }
+
+  constexpr difference_type operator-(
+      const curve_random_access_iterator& that) const noexcept {
+    return this->index_.row - that.index_.row;
+  }
+
+  constexpr reference operator*() const {
+    if constexpr (kMortonTag && requires { this->at(position_); }) {
+      return this->at(position_);
+    } else {
+      return (*this)(cell_);
+    }
+  }
+
+  /*
+   * Index of the referenced cell in the matrix
+   */
+  constexpr utils::index cell() const noexcept { return cell_; }
+
+ private:
+  constexpr utils::index decode(std::uint64_t position) const noexcept {
+    if constexpr (kMortonTag) {
+      return utils::morton_decode(position);
+    } else {
+      return utils::hilbert_decode(position, order_);
+    }
+  }
+
+  /*
+   * Number of cells of the matrix in the aligned square of side 2^level that
+   * the curve enters at the position
+   */
+  constexpr std::ptrdiff_t count(std::uint64_t position,
+                                 int level) const noexcept {
+    const auto side = std::ptrdiff_t(1) << level;
+    const auto corner = decode(position);
+    return std::clamp<std::ptrdiff_t>(rows_ - (corner.row & -side), 0, side) *
+           std::clamp<std::ptrdiff_t>(columns_ - (corner.column & -side), 0,
+                                      side);
+  }
+
+  /*
+   * Moves the curve position forward to the first cell of the matrix,
+   * jumping over the largest aligned squares outside of it
+   */
+  constexpr void skip() noexcept {
+    for (cell_ = decode(position_);
+         cell_.row >= rows_ || cell_.column >= columns_;
+         cell_ = decode(position_)) {
+      auto level = std::min(std::countr_zero(position_) / 2, order_);
+      while (count(position_, level) != 0) {
+        --level;
+      }
+      position_ += std::uint64_t(1) << (2 * level);
+    }
+  }
+
+  /*
+   * Finds the curve position of the element by descending into the aligned
+   * squares that hold it
+   */
+  constexpr void seek() noexcept {
+    auto n = this->index_.row;
+    if (n >= rows_ * columns_) {
+      position_ = std::uint64_t(1) << (2 * order_);
+      cell_ = {rows_, 0};
+      return;
+    }
+
+    position_ = 0;
+    for (int level = order_ - 1; level >= 0; --level) {
+      const auto quadrant = std::uint64_t(1) << (2 * level);
+      for (auto cells = count(position_, level); n >= cells;
+           cells = count(position_, level)) {
+        n -= cells;
+        position_ += quadrant;
+      }
+    }
+    cell_ = decode(position_);
+  }
+
+ private:
+  std::ptrdiff_t rows_ = 0;
+  std::ptrdiff_t columns_ = 0;
+  int order_ = 0;
+
+  std::uint64_t position_ = 0;
+  utils::index cell_ = {0, 0};
+};
+
+}  // namespace matrix_views::iterators
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <utility>
+
+#include "iterators/base_random_access_iterator.hpp"
+#include "iterators/tagged_random_access_iterator.hpp"
+#include "utils/index.hpp"
+#include "utils/tags.hpp"
+
+namespace matrix_views::iterators {
+
+/*
+ * Concept representing a storage proxy that stores only the nonzeros of the
+ * stripes in the direction of the tag, e.g. compressed_storage_proxy
+ */
+template <typename StorageProxy, typename Tag>
+concept sparse_random_access_iterator_storage_proxy =
+    tagged_random_access_iterator_storage_proxy<StorageProxy> &&
+    requires(const StorageProxy storage_proxy, std::ptrdiff_t n) {
+      { storage_proxy.first(n) } -> std::same_as<std::ptrdiff_t>;
+      { storage_proxy.last(n) } -> std::same_as<std::ptrdiff_t>;
+      { storage_proxy.index(n, n) } -> std::same_as<utils::index>;
+      { storage_proxy.value(n) };
+      requires StorageProxy::compressed(Tag{});
+    };
+
+/*
+ * Iterator over the stored nonzeros of a row or a column. Dereferences to an
+ * (index, value) pair
+ */
+template <typename Tag, typename StorageProxy>
+  requires(std::same_as<Tag, utils::kRowTag> ||
+           std::same_as<Tag, utils::kColumnTag>) &&
+          sparse_random_access_iterator_storage_proxy<StorageProxy, Tag>
+class sparse_random_access_iterator final
+    : public base_random_access_iterator<
+          sparse_random_access_iterator<Tag, StorageProxy>>,
+      public StorageProxy {
+ private:
+  using difference_type = base_random_access_iterator<
+      sparse_random_access_iterator>::difference_type;
+
+ public:
+  using value_type =
+      std::pair<utils::index, typename StorageProxy::value_type>;
+  using reference = value_type;
+
+  constexpr sparse_random_access_iterator() noexcept = default;
+
+  /*
+   * The index is the number of the row or the column and the position of
+   * the nonzero in the storage, i.e. {i, storage_proxy.first(i)} is the first
+   * nonzero of the i-th stripe
+   */
+  constexpr sparse_random_access_iterator(Tag, utils::index index,
+                                          StorageProxy storage_proxy) noexcept
+      : base_random_access_iterator<sparse_random_access_iterator>(index),
+        StorageProxy(std::move(storage_proxy)) {}
+
+ public:
+  constexpr sparse_random_access_iterator& operator+=(
+      difference_type n) noexcept {
+    this->index_.column += n;
+    return *this;
+  }
+
+  constexpr difference_type operator-(
+      const sparse_random_access_iterator& that) const noexcept {
+    return this->index_.column - that.index_.column;
+  }
+
+  constexpr reference operator*() const noexcept {
+    return {StorageProxy::index(this->index_.row, this->index_.column),
+            StorageProxy::value(this->index_.column)};
+  }
+};
+
+}  // namespace matrix_views::iterators
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <algorithm>
+#include <span>
+
+#include "iterators/base_random_access_iterator.hpp"
+#include "iterators/tagged_random_access_iterator.hpp"
+#include "ranges/tagged_random_access_range.hpp"
+#include "utils/conditionally_runtime.hpp"
+#include "utils/index.hpp"
+#include "utils/tags.hpp"
+
+namespace matrix_views::iterators {
+
+/*
+ * Iterator over the stripes of a matrix in a set direction. Dereferences to a
+ * tagged_random_access_range sharing the storage proxy of the iterator.
+ * Optionally stores matrix dimensions in the type
+ *
+ * Rows and columns are ordered from the top left corner. Diagonals are ordered
+ * from the bottom left corner to the top right corner and antidiagonals from
+ * the top left corner to the bottom right corner
+ *
+ * The stripes hand out iterators with index components of the Index type
+ */
+template <tagged_random_access_iterator_tag Tag,
+          tagged_random_access_iterator_storage_proxy StorageProxy,
+          std::size_t Rows = std::dynamic_extent,
+          std::size_t Columns = std::dynamic_extent,
+          utils::index_integral Index = utils::default_index_t<Rows, Columns>>
+class stripe_random_access_iterator final
+    : public base_random_access_iterator<stripe_random_access_iterator<
+          Tag, StorageProxy, Rows, Columns, Index>>,
+      public StorageProxy {
+ private:
+  static inline const constinit bool kDynamicRows = Rows == std::dynamic_extent;
+  static inline const constinit bool kDynamicColumns =
+      Columns == std::dynamic_extent;
+
+ private:
+  static inline const constinit bool kRowTag =
+      std::is_same_v<Tag, utils::kRowTag>;
+  static inline const constinit bool kColumnTag =
+      std::is_same_v<Tag, utils::kColumnTag>;
+  static inline const constinit bool kDiagonalTag =
+      std::is_same_v<Tag, utils::kDiagonalTag>;
+  static inline const constinit bool kAntidiagonalTag =
+      std::is_same_v<Tag, utils::kAntidiagonalTag>;
+
+  using difference_type = base_random_access_iterator<
+      stripe_random_access_iterator>::difference_type;
+
+ public:
+  using value_type =
+      ranges::tagged_random_access_range<Tag, StorageProxy, Rows, Columns, 1,
+                                         Index>;
+  using reference = value_type;
+
+  constexpr stripe_random_access_iterator() noexcept = default;
+
+  /*
+   * The index is the start of a row or a column stripe. The k-th diagonal or
+   * antidiagonal stripe is identified by {0, k}, where diagonals above the
+   * main one are positive and antidiagonals are the cells with row + column
+   * equal to k
+   */
+  constexpr stripe_random_access_iterator(
+      Tag, utils::index index, StorageProxy storage_proxy,
+      std::size_t rows = std::dynamic_extent,
+      std::size_t columns = std::dynamic_extent) noexcept
+      : base_random_access_iterator<stripe_random_access_iterator>(index),
+        StorageProxy(std::move(storage_proxy)),
+        rows_(utils::runtime_if<kDynamicRows>(rows)),
+        columns_(utils::runtime_if<kDynamicColumns>(columns)) {}
+
+ public:
+  constexpr stripe_random_access_iterator& operator+=(
+      difference_type n) noexcept {
+    if constexpr (kRowTag) {
+      this->index_.row += n;
+    } else {
+      this->index_.column += n;
+    }
+    return *this;
+  }
+
+  constexpr difference_type operator-(
+      const stripe_random_access_iterator& that) const noexcept {
+    if constexpr (kRowTag) {
+      return this->index_.row - that.index_.row;
+    } else {
+      return this->index_.column - that.index_.column;
+    }
+  }
+
+  constexpr reference operator*() const noexcept {
+    return value_type(Tag{}, start(), static_cast<const StorageProxy&>(*this),
+                      *rows_, *columns_);
+  }
+
+ private:
+  constexpr utils::index start() const noexcept {
+    if constexpr (kRowTag || kColumnTag) {
+      return this->index_;
+    } else if constexpr (kDiagonalTag) {
+      const auto k = this->index_.column;
+      return k < 0 ? utils::index{-k, 0} : utils::index{0, k};
+    } else {
+      static_assert(kAntidiagonalTag);
+      const auto k = this->index_.column;
+      const auto last_column = static_cast<std::ptrdiff_t>(*columns_) - 1;
+      return {std::max<std::ptrdiff_t>(k - last_column, 0),
+              std::min(k, last_column)};
+    }
+  }
+
+ private:
+  [[no_unique_address]] utils::conditionally_runtime<std::size_t, kDynamicRows,
+                                                     Rows> rows_ =
+      utils::runtime_if<kDynamicRows>(std::size_t());
+  [[no_unique_address]] utils::conditionally_runtime<
+      std::size_t, kDynamicColumns, Columns> columns_ =
+      utils::runtime_if<kDynamicColumns>(std::size_t());
+};
+
+}  // namespace matrix_views::iterators
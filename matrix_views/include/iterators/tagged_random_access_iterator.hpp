@@ -1,6 +1,9 @@
 #pragma once
 
+#include <span>
+
 #include "iterators/base_random_access_iterator.hpp"
+#include "utils/conditionally_runtime.hpp"
 #include "utils/tags.hpp"
 
 namespace matrix_views::iterators {
@@ -21,17 +24,95 @@ template <typename StorageProxy>
 concept tagged_random_access_iterator_storage_proxy =
     std::invocable<const StorageProxy, utils::index>;
 
+/*
+ * Concept representing a storage proxy that exposes a pointer to the
+ * referenced element and a constant offset between adjacent elements of a
+ * stripe. Iterators over such proxies advance the pointer directly
+ *
+ * The iterator derives from the proxy, which drops its cv-qualifiers, so a
+ * const proxy type is advanced like the plain one
+ */
+template <typename StorageProxy, typename Tag>
+concept tagged_random_access_iterator_strided_storage_proxy =
+    tagged_random_access_iterator_storage_proxy<StorageProxy> &&
+    requires(const StorageProxy const_storage_proxy,
+             std::remove_cv_t<StorageProxy> storage_proxy, utils::index index,
+             std::ptrdiff_t offset) {
+      {
+        const_storage_proxy.data()
+      } -> std::same_as<typename StorageProxy::pointer>;
+      { const_storage_proxy.offset(index) } -> std::same_as<std::ptrdiff_t>;
+      { const_storage_proxy.stride(Tag{}) } -> std::same_as<std::ptrdiff_t>;
+      { storage_proxy.advance(offset) };
+    };
+
+/*
+ * Concept representing a strided storage proxy with a unit stride known at
+ * compile time. Iterators over such proxies model std::contiguous_iterator
+ */
+template <typename StorageProxy, typename Tag>
+concept tagged_random_access_iterator_contiguous_storage_proxy =
+    tagged_random_access_iterator_strided_storage_proxy<StorageProxy, Tag> &&
+    std::is_lvalue_reference_v<typename StorageProxy::reference> &&
+    requires { requires StorageProxy::contiguous(Tag{}); };
+
+/*
+ * Concept representing a storage proxy that reads the elements through a
+ * cursor in the direction of the tag, e.g. on the resident tile of a tiled
+ * matrix. Iterators over such proxies dereference through the cursor
+ */
+template <typename StorageProxy, typename Tag>
+concept tagged_random_access_iterator_cursor_storage_proxy =
+    tagged_random_access_iterator_storage_proxy<StorageProxy> &&
+    requires(const StorageProxy storage_proxy, utils::index index) {
+      {
+        storage_proxy.at(Tag{}, index)
+      } -> std::same_as<typename StorageProxy::reference>;
+    };
+
+/*
+ * Sentinel of a tagged range. Holds the row, or the column for rows, that
+ * the iterators reach past the last element, so that the end check compares
+ * one index component against a constant
+ */
+template <tagged_random_access_iterator_tag Tag>
+class tagged_random_access_sentinel final {
+ public:
+  constexpr tagged_random_access_sentinel() noexcept = default;
+  constexpr explicit tagged_random_access_sentinel(
+      std::ptrdiff_t position) noexcept
+      : position_(position) {}
+
+ public:
+  constexpr std::ptrdiff_t position() const noexcept { return position_; }
+
+ private:
+  std::ptrdiff_t position_ = 0;
+};
+
 /*
  * Tagged iterator class with a set direction. Implements iterator movement but
  * leaves dereferencing unimplemented
+ *
+ * Moves by a step of cells in the direction per element, e.g. every other
+ * cell of a row for the step of 2. The step is either set in the type or
+ * passed at runtime
+ *
+ * Keeps the index in components of the Index type, e.g. std::int32_t halves
+ * it for matrices under 2^31 per side. Movement and distances are computed in
+ * std::ptrdiff_t, so that narrow indices do not overflow in between
  */
 template <tagged_random_access_iterator_tag Tag,
-          tagged_random_access_iterator_storage_proxy StorageProxy>
+          tagged_random_access_iterator_storage_proxy StorageProxy,
+          std::size_t Step = 1, utils::index_integral Index = std::ptrdiff_t>
 class tagged_random_access_iterator final
     : public base_random_access_iterator<
-          tagged_random_access_iterator<Tag, StorageProxy>>,
+          tagged_random_access_iterator<Tag, StorageProxy, Step, Index>,
+          Index>,
       public StorageProxy {
  private:
+  static inline const constinit bool kDynamicStep = Step == std::dynamic_extent;
+
   static inline const constinit bool kRowTag =
       std::is_same_v<Tag, utils::kRowTag>;
   static inline const constinit bool kColumnTag =
@@ -41,48 +122,133 @@ class tagged_random_access_iterator final
   static inline const constinit bool kAntidiagonalTag =
       std::is_same_v<Tag, utils::kAntidiagonalTag>;
 
-  using difference_type = base_random_access_iterator<
-      tagged_random_access_iterator>::difference_type;
+  static inline const constinit bool kStrided =
+      tagged_random_access_iterator_strided_storage_proxy<StorageProxy, Tag>;
+  static inline const constinit bool kContiguous =
+      tagged_random_access_iterator_contiguous_storage_proxy<StorageProxy,
+                                                             Tag> &&
+      Step == 1;
+  static inline const constinit bool kCursor =
+      !kStrided &&
+      tagged_random_access_iterator_cursor_storage_proxy<StorageProxy, Tag>;
+
+  using base = base_random_access_iterator<tagged_random_access_iterator,
+                                           Index>;
+  using difference_type = typename base::difference_type;
   using reference = typename StorageProxy::reference;
 
  public:
+  using iterator_concept =
+      std::conditional_t<kContiguous, std::contiguous_iterator_tag,
+                         std::random_access_iterator_tag>;
+
   constexpr tagged_random_access_iterator() noexcept = default;
-  constexpr tagged_random_access_iterator(Tag, utils::index index,
-                                          StorageProxy&& storage_proxy) noexcept
-      : base_random_access_iterator<tagged_random_access_iterator>(index),
-        StorageProxy(std::move(storage_proxy)) {}
+  constexpr tagged_random_access_iterator(
+      Tag, utils::index index, StorageProxy&& storage_proxy,
+      std::size_t step = Step) noexcept
+      : base(static_cast<utils::basic_index<Index>>(index)),
+        StorageProxy(std::move(storage_proxy)),
+        step_(utils::runtime_if<kDynamicStep>(
+            static_cast<std::ptrdiff_t>(step))) {
+    if constexpr (kStrided) {
+      StorageProxy::advance(StorageProxy::offset(index));
+    }
+  }
 
  public:
   constexpr tagged_random_access_iterator& operator+=(
       difference_type n) noexcept {
+    n *= *step_;
     if constexpr (kRowTag) {
-      this->index_.column += n;
+      add(this->index_.column, n);
     } else if constexpr (kColumnTag) {
-      this->index_.row += n;
+      add(this->index_.row, n);
     } else if constexpr (kDiagonalTag) {
-      this->index_.row += n, this->index_.column += n;
+      add(this->index_.row, n), add(this->index_.column, n);
     } else {
       static_assert(kAntidiagonalTag);
-      this->index_.row += n, this->index_.column -= n;
+      add(this->index_.row, n), add(this->index_.column, -n);
+    }
+    if constexpr (kStrided) {
+      StorageProxy::advance(n * StorageProxy::stride(Tag{}));
     }
     return *this;
   }
 
   constexpr difference_type operator-(
       const tagged_random_access_iterator& that) const noexcept {
+    return (position() - that.position()) / *step_;
+  }
+
+  using base::operator==;
+  constexpr bool operator==(
+      const tagged_random_access_sentinel<Tag>& sentinel) const noexcept {
+    return position() == sentinel.position();
+  }
+
+  constexpr difference_type operator-(
+      const tagged_random_access_sentinel<Tag>& sentinel) const noexcept {
+    return (position() - sentinel.position()) / *step_;
+  }
+
+  friend constexpr difference_type operator-(
+      const tagged_random_access_sentinel<Tag>& sentinel,
+      const tagged_random_access_iterator& that) noexcept {
+    return -(that - sentinel);
+  }
+
+  /*
+   * The index component that changes with every element, i.e. the column for
+   * rows and the row otherwise
+   */
+  constexpr difference_type position() const noexcept {
     if constexpr (kRowTag) {
-      return this->index_.column - that.index_.column;
-    } else if constexpr (kColumnTag) {
-      return this->index_.row - that.index_.row;
-    } else if constexpr (kDiagonalTag) {
-      return this->index_.row - that.index_.row;
+      return static_cast<difference_type>(this->index_.column);
     } else {
-      static_assert(kAntidiagonalTag);
-      return this->index_.row - that.index_.row;
+      static_assert(kColumnTag || kDiagonalTag || kAntidiagonalTag);
+      return static_cast<difference_type>(this->index_.row);
     }
   }
 
-  constexpr reference operator*() const { return (*this)(this->index_); }
+  constexpr reference operator*() const {
+    if constexpr (kStrided) {
+      return *StorageProxy::data();
+    } else if constexpr (kCursor) {
+      return StorageProxy::at(Tag{}, static_cast<utils::index>(this->index_));
+    } else {
+      return (*this)(static_cast<utils::index>(this->index_));
+    }
+  }
+
+  /*
+   * Constant offset in memory between the elements referenced by adjacent
+   * iterators. Available only over strided storage proxies
+   */
+  constexpr std::ptrdiff_t stride() const noexcept
+    requires kStrided
+  {
+    return *step_ * StorageProxy::stride(Tag{});
+  }
+
+  constexpr decltype(auto) operator->() const
+    requires std::is_lvalue_reference_v<reference>
+  {
+    if constexpr (kStrided) {
+      return StorageProxy::data();
+    } else {
+      return base::operator->();
+    }
+  }
+
+ private:
+  static constexpr void add(Index& component, difference_type n) noexcept {
+    component = static_cast<Index>(static_cast<difference_type>(component) + n);
+  }
+
+ private:
+  [[no_unique_address]] utils::conditionally_runtime<
+      std::ptrdiff_t, kDynamicStep, static_cast<std::ptrdiff_t>(Step)> step_ =
+      utils::runtime_if<kDynamicStep>(std::ptrdiff_t(1));
 };
 
 }  // namespace matrix_views::iterators
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <span>
+
+#include "iterators/base_random_access_iterator.hpp"
+#include "iterators/tagged_random_access_iterator.hpp"
+#include "ranges/window_random_access_range.hpp"
+#include "utils/conditionally_runtime.hpp"
+#include "utils/tags.hpp"
+
+namespace matrix_views::iterators {
+
+/*
+ * Iterator over the square tiles of a matrix. Dereferences to a
+ * window_random_access_range sharing the storage proxy of the iterator.
+ * Optionally stores the tile size and matrix dimensions in the type
+ *
+ * Tiles are ordered from the top left corner, left to right and then top to
+ * bottom. Tiles at the right and bottom edges are cut by the matrix
+ */
+template <tagged_random_access_iterator_storage_proxy StorageProxy,
+          std::size_t TileSize = std::dynamic_extent,
+          std::size_t Rows = std::dynamic_extent,
+          std::size_t Columns = std::dynamic_extent>
+class tile_random_access_iterator final
+    : public base_random_access_iterator<
+          tile_random_access_iterator<StorageProxy, TileSize, Rows, Columns>>,
+      public StorageProxy {
+ private:
+  static inline const constinit bool kDynamicTileSize =
+      TileSize == std::dynamic_extent;
+  static_assert(TileSize != 0, "the tile size must be positive");
+  static inline const constinit bool kDynamicRows = Rows == std::dynamic_extent;
+  static inline const constinit bool kDynamicColumns =
+      Columns == std::dynamic_extent;
+
+  using difference_type = base_random_access_iterator<
+      tile_random_access_iterator>::difference_type;
+
+ public:
+  using value_type = ranges::window_random_access_range<StorageProxy>;
+  using reference = value_type;
+
+  constexpr tile_random_access_iterator() noexcept = default;
+
+  /*
+   * The index is the position of the tile in the grid of tiles, i.e. {i, j}
+   * is the tile whose top left corner is {i * tile_size, j * tile_size}
+   */
+  constexpr tile_random_access_iterator(utils::kTileTag, utils::index index,
+                                        StorageProxy storage_proxy) noexcept
+    requires(!kDynamicTileSize && !kDynamicRows && !kDynamicColumns)
+      : base_random_access_iterator<tile_random_access_iterator>(index),
+        StorageProxy(std::move(storage_proxy)) {}
+  /*
+   * The tile size must be positive. The tile size and dimensions set in the
+   * type must match the ones passed
+   */
+  constexpr tile_random_access_iterator(utils::kTileTag, utils::index index,
+                                        StorageProxy storage_proxy,
+                                        std::size_t tile_size,
+                                        std::size_t rows,
+                                        std::size_t columns) noexcept
+      : base_random_access_iterator<tile_random_access_iterator>(index),
+        StorageProxy(std::move(storage_proxy)),
+        tile_size_(utils::runtime_if<kDynamicTileSize>(tile_size)),
+        rows_(utils::runtime_if<kDynamicRows>(rows)),
+        columns_(utils::runtime_if<kDynamicColumns>(columns)) {
+    assert(tile_size > 0 && *tile_size_ == tile_size);
+    assert(*rows_ == rows && *columns_ == columns);
+  }
+
+ public:
+  constexpr tile_random_access_iterator& operator+=(
+      difference_type n) noexcept {
+    const auto tile_columns = this->tile_columns();
+    const auto position =
+        this->index_.row * tile_columns + this->index_.column + n;
+    this->index_ = {position / tile_columns, position % tile_columns};
+    return *this;
+  }
+
+  constexpr difference_type operator-(
+      const tile_random_access_iterator& that) const noexcept {
+    return (this->index_.row - that.index_.row) * tile_columns() +
+           (this->index_.column - that.index_.column);
+  }
+
+  constexpr reference operator*() const noexcept {
+    const auto tile_size = static_cast<std::ptrdiff_t>(*tile_size_);
+    const auto row = this->index_.row * tile_size;
+    const auto column = this->index_.column * tile_size;
+    return value_type({row, column}, static_cast<const StorageProxy&>(*this),
+                      static_cast<std::size_t>(std::min(
+                          tile_size, static_cast<std::ptrdiff_t>(*rows_) - row)),
+                      static_cast<std::size_t>(std::min(
+                          tile_size,
+                          static_cast<std::ptrdiff_t>(*columns_) - column)));
+  }
+
+ private:
+  constexpr std::ptrdiff_t tile_columns() const noexcept {
+    return static_cast<std::ptrdiff_t>((*columns_ + *tile_size_ - 1) /
+                                       *tile_size_);
+  }
+
+ private:
+  [[no_unique_address]] utils::conditionally_runtime<
+      std::size_t, kDynamicTileSize, TileSize> tile_size_ =
+      utils::runtime_if<kDynamicTileSize>(std::size_t());
+  [[no_unique_address]] utils::conditionally_runtime<std::size_t, kDynamicRows,
+                                                     Rows> rows_ =
+      utils::runtime_if<kDynamicRows>(std::size_t());
+  [[no_unique_address]] utils::conditionally_runtime<
+      std::size_t, kDynamicColumns, Columns> columns_ =
+      utils::runtime_if<kDynamicColumns>(std::size_t());
+};
+
+}  // namespace matrix_views::iterators
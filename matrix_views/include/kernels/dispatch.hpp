@@ -0,0 +1,85 @@
+#pragma once
+
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <type_traits>
+
+/*
+ * Compiles the marked function once per listed instruction set and picks the
+ * best clone at load time by CPU feature detection. Other targets, such as
+ * NEON on AArch64, are vectorized for the baseline instruction set instead
+ */
+#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__)
+#define MATRIX_VIEWS_TARGET_CLONES \
+  __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+#define MATRIX_VIEWS_TARGET_CLONES
+#endif
+
+namespace matrix_views::kernels {
+
+/*
+ * Concept representing a sized range of adjacent elements in memory
+ */
+template <typename Range>
+concept contiguous_kernel_range =
+    std::ranges::contiguous_range<Range> && std::ranges::sized_range<Range>;
+
+/*
+ * Concept representing a sized range of elements in memory separated by a
+ * constant offset, e.g. a tagged range over a strided storage proxy
+ */
+template <typename Range>
+concept strided_kernel_range =
+    contiguous_kernel_range<Range> ||
+    (std::ranges::random_access_range<Range> &&
+     std::ranges::sized_range<Range> &&
+     std::is_lvalue_reference_v<std::ranges::range_reference_t<Range>> &&
+     requires(const std::ranges::iterator_t<Range> iterator) {
+       { iterator.stride() } -> std::same_as<std::ptrdiff_t>;
+     });
+
+namespace detail {
+
+/*
+ * Stride of contiguous ranges. Known at compile time so that kernels
+ * instantiated with it load adjacent elements with vector instructions
+ */
+using unit_stride = std::integral_constant<std::ptrdiff_t, 1>;
+
+/*
+ * Pointer, length and step of a strided_kernel_range
+ */
+template <typename T>
+struct strided_span final {
+  T* data;
+  std::ptrdiff_t size;
+  std::ptrdiff_t stride;
+};
+
+template <strided_kernel_range Range>
+constexpr auto make_strided_span(Range&& range) noexcept {
+  using element_type =
+      std::remove_reference_t<std::ranges::range_reference_t<Range>>;
+
+  const auto size = std::ranges::ssize(range);
+  if constexpr (contiguous_kernel_range<Range>) {
+    return strided_span<element_type>{std::ranges::data(range), size, 1};
+  } else {
+    const auto begin = std::ranges::begin(range);
+    return size == 0 ? strided_span<element_type>{nullptr, 0, 1}
+                     : strided_span<element_type>{std::addressof(*begin), size,
+                                                  begin.stride()};
+  }
+}
+
+/*
+ * Number of independent accumulators of reduction kernels. Enough to fill one
+ * 512-bit register with floats and to hide the latency of the additions
+ */
+inline constexpr std::ptrdiff_t kLanes = 16;
+
+}  // namespace detail
+
+}  // namespace matrix_views::kernels
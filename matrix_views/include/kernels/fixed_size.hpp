@@ -0,0 +1,267 @@
+#pragma once
+
+#include <array>
+#include <concepts>
+#include <functional>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "matrices/matrix_view.hpp"
+#include "ranges/tagged_random_access_range.hpp"
+#include "utils/index.hpp"
+#include "utils/tags.hpp"
+
+namespace matrix_views::kernels {
+
+namespace detail {
+
+/*
+ * Dimensions of a matrix taken by value or by reference
+ */
+template <typename Matrix>
+inline constexpr std::size_t kRowsOf =
+    matrices::kRowsOf<std::remove_cvref_t<Matrix>&>;
+template <typename Matrix>
+inline constexpr std::size_t kColumnsOf =
+    matrices::kColumnsOf<std::remove_cvref_t<Matrix>&>;
+
+}  // namespace detail
+
+/*
+ * Concept representing a matrix whose dimensions are stored in its type, e.g.
+ * matrix<float, 4, 4> or a submatrix<3, 3> view. Kernels do not keep their
+ * arguments, so temporaries are accepted
+ */
+template <typename Matrix>
+concept fixed_size_matrix =
+    matrices::matrix_view_operand<std::remove_cvref_t<Matrix>&> &&
+    detail::kRowsOf<Matrix> != std::dynamic_extent &&
+    detail::kColumnsOf<Matrix> != std::dynamic_extent &&
+    detail::kRowsOf<Matrix> != 0 && detail::kColumnsOf<Matrix> != 0;
+
+/*
+ * Concept representing a fixed_size_matrix with as many rows as columns
+ */
+template <typename Matrix>
+concept fixed_size_square_matrix =
+    fixed_size_matrix<Matrix> &&
+    detail::kRowsOf<Matrix> == detail::kColumnsOf<Matrix>;
+
+namespace detail {
+
+/*
+ * The kernels below copy the matrices into row-major arrays and expand every
+ * loop over them into a pack expansion over a compile time index sequence, so
+ * that small matrices are processed by straight-line code on registers
+ */
+template <std::size_t Columns>
+constexpr utils::index fixed_index(std::size_t i) noexcept {
+  return {static_cast<std::ptrdiff_t>(i / Columns),
+          static_cast<std::ptrdiff_t>(i % Columns)};
+}
+
+template <typename Matrix>
+using fixed_value_t = typename std::remove_cvref_t<Matrix>::value_type;
+
+template <typename Matrix>
+using fixed_array_t =
+    std::array<fixed_value_t<Matrix>,
+               detail::kRowsOf<Matrix> * detail::kColumnsOf<Matrix>>;
+
+template <fixed_size_matrix Matrix>
+constexpr fixed_array_t<Matrix> load(Matrix&& matrix) {
+  constexpr auto kColumns = detail::kColumnsOf<Matrix>;
+
+  const auto storage_proxy = matrix.storage();
+  return [&]<std::size_t... I>(std::index_sequence<I...>) {
+    return fixed_array_t<Matrix>{storage_proxy(fixed_index<kColumns>(I))...};
+  }(std::make_index_sequence<std::tuple_size_v<fixed_array_t<Matrix>>>());
+}
+
+template <fixed_size_matrix Matrix, typename T, std::size_t Size>
+constexpr void store(Matrix&& matrix, const std::array<T, Size>& values) {
+  constexpr auto kColumns = detail::kColumnsOf<Matrix>;
+
+  const auto storage_proxy = matrix.storage();
+  [&]<std::size_t... I>(std::index_sequence<I...>) {
+    ((storage_proxy(fixed_index<kColumns>(I)) = values[I]), ...);
+  }(std::make_index_sequence<Size>());
+}
+
+/*
+ * Inner product of the Row-th row of lhs and the Column-th column of rhs
+ */
+template <std::size_t Row, std::size_t Column, std::size_t Inner,
+          std::size_t Columns, typename T, typename U, std::size_t LhsSize,
+          std::size_t RhsSize>
+constexpr std::common_type_t<T, U> fixed_dot(
+    const std::array<T, LhsSize>& lhs, const std::array<U, RhsSize>& rhs) {
+  using result_type = std::common_type_t<T, U>;
+
+  return [&]<std::size_t... K>(std::index_sequence<K...>) {
+    return (... + (static_cast<result_type>(lhs[Row * Inner + K]) *
+                   static_cast<result_type>(rhs[K * Columns + Column])));
+  }(std::make_index_sequence<Inner>());
+}
+
+/*
+ * Elements of the N x N matrix without the Row-th row and the Column-th
+ * column
+ */
+template <std::size_t N, std::size_t Row, std::size_t Column, typename T>
+constexpr std::array<T, (N - 1) * (N - 1)> fixed_minor(
+    const std::array<T, N * N>& values) {
+  return [&]<std::size_t... I>(std::index_sequence<I...>) {
+    return std::array<T, (N - 1) * (N - 1)>{
+        values[(I / (N - 1) + (I / (N - 1) >= Row)) * N +
+               (I % (N - 1) + (I % (N - 1) >= Column))]...};
+  }(std::make_index_sequence<(N - 1) * (N - 1)>());
+}
+
+template <std::size_t N, typename T>
+constexpr T fixed_determinant(const std::array<T, N * N>& values);
+
+/*
+ * Signed determinant of the minor of the element at {Row, Column}
+ */
+template <std::size_t N, std::size_t Row, std::size_t Column, typename T>
+constexpr T fixed_cofactor(const std::array<T, N * N>& values) {
+  const auto determinant =
+      fixed_determinant<N - 1>(fixed_minor<N, Row, Column>(values));
+  return (Row + Column) % 2 == 0 ? determinant : -determinant;
+}
+
+/*
+ * Laplace expansion along the first row
+ */
+template <std::size_t N, typename T>
+constexpr T fixed_determinant(const std::array<T, N * N>& values) {
+  if constexpr (N == 1) {
+    return values[0];
+  } else if constexpr (N == 2) {
+    return values[0] * values[3] - values[1] * values[2];
+  } else {
+    return [&]<std::size_t... J>(std::index_sequence<J...>) {
+      return (... + (values[J] * fixed_cofactor<N, 0, J>(values)));
+    }(std::make_index_sequence<N>());
+  }
+}
+
+}  // namespace detail
+
+/*
+ * Writes the product of two matrices to the destination. All operands store
+ * their dimensions in the type, so the product is computed by straight-line
+ * code. The operands are read before the destination is written, so it may
+ * be one of them
+ */
+template <fixed_size_matrix Lhs, fixed_size_matrix Rhs,
+          fixed_size_matrix Destination>
+  requires(detail::kColumnsOf<Lhs> == detail::kRowsOf<Rhs> &&
+           detail::kRowsOf<Destination> == detail::kRowsOf<Lhs> &&
+           detail::kColumnsOf<Destination> == detail::kColumnsOf<Rhs>)
+constexpr void multiply(Lhs&& lhs, Rhs&& rhs, Destination&& destination) {
+  constexpr auto kInner = detail::kColumnsOf<Lhs>;
+  constexpr auto kColumns = detail::kColumnsOf<Rhs>;
+
+  const auto lhs_values = detail::load(lhs);
+  const auto rhs_values = detail::load(rhs);
+  const auto values = [&]<std::size_t... I>(std::index_sequence<I...>) {
+    return std::array{
+        detail::fixed_dot<I / kColumns, I % kColumns, kInner, kColumns>(
+            lhs_values, rhs_values)...};
+  }(std::make_index_sequence<detail::kRowsOf<Lhs> * kColumns>());
+  detail::store(destination, values);
+}
+
+/*
+ * Determinant of a square matrix with the dimensions stored in the type. The
+ * expansion grows factorially, so it is limited to matrices up to 4 x 4
+ */
+template <fixed_size_square_matrix Matrix>
+  requires(detail::kRowsOf<Matrix> <= 4)
+constexpr detail::fixed_value_t<Matrix> determinant(Matrix&& matrix) {
+  return detail::fixed_determinant<detail::kRowsOf<Matrix>>(
+      detail::load(matrix));
+}
+
+/*
+ * Writes the inverse of a square matrix of floating point numbers up to 4 x 4
+ * to the destination, which may be the matrix itself. Returns false and
+ * leaves the destination intact if the matrix is singular
+ */
+template <fixed_size_square_matrix Matrix,
+          fixed_size_square_matrix Destination>
+  requires(detail::kRowsOf<Matrix> <= 4 &&
+           detail::kRowsOf<Destination> == detail::kRowsOf<Matrix> &&
+           std::floating_point<detail::fixed_value_t<Matrix>>)
+constexpr bool inverse(Matrix&& matrix, Destination&& destination) {
+  constexpr auto kN = detail::kRowsOf<Matrix>;
+  using value_type = detail::fixed_value_t<Matrix>;
+
+  const auto values = detail::load(matrix);
+  if constexpr (kN == 1) {
+    if (values[0] == value_type()) {
+      return false;
+    }
+    detail::store(destination, std::array{value_type(1) / values[0]});
+  } else {
+    // The inverse is the transposed matrix of cofactors over the determinant
+    const auto cofactors = [&]<std::size_t... I>(std::index_sequence<I...>) {
+      return std::array{
+          detail::fixed_cofactor<kN, I / kN, I % kN>(values)...};
+    }(std::make_index_sequence<kN * kN>());
+    const auto determinant = [&]<std::size_t... J>(std::index_sequence<J...>) {
+      return (... + (values[J] * cofactors[J]));
+    }(std::make_index_sequence<kN>());
+    if (determinant == value_type()) {
+      return false;
+    }
+
+    const auto reciprocal = value_type(1) / determinant;
+    detail::store(destination, [&]<std::size_t... I>(
+                                   std::index_sequence<I...>) {
+      return std::array{(cofactors[I % kN * kN + I / kN] * reciprocal)...};
+    }(std::make_index_sequence<kN * kN>()));
+  }
+  return true;
+}
+
+/*
+ * Reductions of every row or every column of a matrix with the dimensions
+ * stored in the type, e.g. reduce(kRow, m) holds the sums of the rows of m
+ */
+template <typename Tag, fixed_size_matrix Matrix,
+          typename Operation = std::plus<>>
+  requires(std::same_as<Tag, utils::kRowTag> ||
+           std::same_as<Tag, utils::kColumnTag>)
+constexpr auto reduce(Tag, Matrix&& matrix, Operation operation = {}) {
+  constexpr bool kRowTag = std::is_same_v<Tag, utils::kRowTag>;
+  constexpr auto kColumns = detail::kColumnsOf<Matrix>;
+
+  constexpr auto kStripeSize = ranges::kStaticSizeOf<
+      std::ranges::range_value_t<decltype(matrix.stripes(Tag{}))>>;
+  constexpr auto kStripes = kRowTag ? detail::kRowsOf<Matrix> : kColumns;
+
+  const auto values = detail::load(matrix);
+  const auto fold = [&]<std::size_t I, std::size_t... J>(
+                        std::integral_constant<std::size_t, I>,
+                        std::index_sequence<J...>) {
+    // Left fold written out so that the operation may be any callable
+    auto result = values[kRowTag ? I * kColumns : I];
+    ((result = operation(
+          result, values[kRowTag ? I * kColumns + J + 1
+                                 : (J + 1) * kColumns + I])),
+     ...);
+    return result;
+  };
+  return [&]<std::size_t... I>(std::index_sequence<I...>) {
+    return std::array{
+        fold(std::integral_constant<std::size_t, I>(),
+             std::make_index_sequence<kStripeSize - 1>())...};
+  }(std::make_index_sequence<kStripes>());
+}
+
+}  // namespace matrix_views::kernels
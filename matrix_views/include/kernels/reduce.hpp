@@ -0,0 +1,190 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+
+#include "kernels/dispatch.hpp"
+
+namespace matrix_views::kernels {
+
+namespace detail {
+
+/*
+ * Reduction of a non-empty strided sequence. Assumes the operation to be
+ * associative and commutative, as std::reduce does
+ */
+template <typename T, typename U, typename Stride, typename Operation>
+MATRIX_VIEWS_TARGET_CLONES T reduce(const U* data, std::ptrdiff_t size,
+                                    Stride stride, Operation operation) {
+  if (size < kLanes) {
+    T result = static_cast<T>(data[0]);
+    for (std::ptrdiff_t i = 1; i < size; ++i) {
+      result = static_cast<T>(operation(result, data[i * stride]));
+    }
+    return result;
+  }
+
+  T lanes[kLanes] = {};
+  for (std::ptrdiff_t lane = 0; lane < kLanes; ++lane) {
+    lanes[lane] = static_cast<T>(data[lane * stride]);
+  }
+  std::ptrdiff_t i = kLanes;
+  for (; i + kLanes <= size; i += kLanes) {
+    for (std::ptrdiff_t lane = 0; lane < kLanes; ++lane) {
+      lanes[lane] =
+          static_cast<T>(operation(lanes[lane], data[(i + lane) * stride]));
+    }
+  }
+  for (; i < size; ++i) {
+    lanes[0] = static_cast<T>(operation(lanes[0], data[i * stride]));
+  }
+
+  T result = lanes[0];
+  for (std::ptrdiff_t lane = 1; lane < kLanes; ++lane) {
+    result = static_cast<T>(operation(result, lanes[lane]));
+  }
+  return result;
+}
+
+template <typename T, typename Stride>
+T sum(const T* data, std::ptrdiff_t size, Stride stride) noexcept {
+  return size == 0 ? T() : reduce<T>(data, size, stride, std::plus<>());
+}
+
+template <typename T, typename U, typename LhsStride, typename RhsStride>
+MATRIX_VIEWS_TARGET_CLONES std::common_type_t<T, U> dot(
+    const T* lhs, LhsStride lhs_stride, const U* rhs, RhsStride rhs_stride,
+    std::ptrdiff_t size) noexcept {
+  using result_type = std::common_type_t<T, U>;
+
+  result_type lanes[kLanes] = {};
+  std::ptrdiff_t i = 0;
+  for (; i + kLanes <= size; i += kLanes) {
+    for (std::ptrdiff_t lane = 0; lane < kLanes; ++lane) {
+      lanes[lane] += static_cast<result_type>(lhs[(i + lane) * lhs_stride]) *
+                     static_cast<result_type>(rhs[(i + lane) * rhs_stride]);
+    }
+  }
+  for (; i < size; ++i) {
+    lanes[0] += static_cast<result_type>(lhs[i * lhs_stride]) *
+                static_cast<result_type>(rhs[i * rhs_stride]);
+  }
+
+  result_type result = result_type();
+  for (std::ptrdiff_t lane = 0; lane < kLanes; ++lane) {
+    result += lanes[lane];
+  }
+  return result;
+}
+
+template <typename T, typename Stride>
+MATRIX_VIEWS_TARGET_CLONES std::ranges::minmax_result<T> minmax(
+    const T* data, std::ptrdiff_t size, Stride stride) noexcept {
+  T min_lanes[kLanes], max_lanes[kLanes];
+  std::fill(std::begin(min_lanes), std::end(min_lanes), data[0]);
+  std::fill(std::begin(max_lanes), std::end(max_lanes), data[0]);
+
+  std::ptrdiff_t i = 0;
+  for (; i + kLanes <= size; i += kLanes) {
+    for (std::ptrdiff_t lane = 0; lane < kLanes; ++lane) {
+      const T value = data[(i + lane) * stride];
+      min_lanes[lane] = value < min_lanes[lane] ? value : min_lanes[lane];
+      max_lanes[lane] = max_lanes[lane] < value ? value : max_lanes[lane];
+    }
+  }
+  for (; i < size; ++i) {
+    const T value = data[i * stride];
+    min_lanes[0] = value < min_lanes[0] ? value : min_lanes[0];
+    max_lanes[0] = max_lanes[0] < value ? value : max_lanes[0];
+  }
+
+  return {*std::min_element(std::begin(min_lanes), std::end(min_lanes)),
+          *std::max_element(std::begin(max_lanes), std::end(max_lanes))};
+}
+
+}  // namespace detail
+
+/*
+ * Sum of the elements of a range. Unit-stride and constant-stride ranges are
+ * summed by vectorized kernels in a different order than std::accumulate, so
+ * floating point results may differ in the last bits
+ */
+template <std::ranges::input_range Range>
+std::ranges::range_value_t<Range> sum(Range&& range) {
+  if constexpr (contiguous_kernel_range<Range>) {
+    return detail::sum(std::ranges::data(range), std::ranges::ssize(range),
+                       detail::unit_stride());
+  } else if constexpr (strided_kernel_range<Range>) {
+    const auto span = detail::make_strided_span(range);
+    return detail::sum(span.data, span.size, span.stride);
+  } else {
+    auto result = std::ranges::range_value_t<Range>();
+    for (auto&& value : range) {
+      result += value;
+    }
+    return result;
+  }
+}
+
+/*
+ * Inner product of two ranges of the same size
+ */
+template <std::ranges::input_range Lhs, std::ranges::input_range Rhs>
+std::common_type_t<std::ranges::range_value_t<Lhs>,
+                   std::ranges::range_value_t<Rhs>>
+dot(Lhs&& lhs, Rhs&& rhs) {
+  using result_type = std::common_type_t<std::ranges::range_value_t<Lhs>,
+                                         std::ranges::range_value_t<Rhs>>;
+
+  if constexpr (contiguous_kernel_range<Lhs> && contiguous_kernel_range<Rhs>) {
+    assert(std::ranges::ssize(lhs) == std::ranges::ssize(rhs));
+    return detail::dot(std::ranges::data(lhs), detail::unit_stride(),
+                       std::ranges::data(rhs), detail::unit_stride(),
+                       std::ranges::ssize(lhs));
+  } else if constexpr (strided_kernel_range<Lhs> &&
+                       strided_kernel_range<Rhs>) {
+    const auto lhs_span = detail::make_strided_span(lhs);
+    const auto rhs_span = detail::make_strided_span(rhs);
+    assert(lhs_span.size == rhs_span.size);
+    return detail::dot(lhs_span.data, lhs_span.stride, rhs_span.data,
+                       rhs_span.stride, lhs_span.size);
+  } else {
+    if constexpr (std::ranges::sized_range<Lhs> &&
+                  std::ranges::sized_range<Rhs>) {
+      assert(std::ranges::ssize(lhs) == std::ranges::ssize(rhs));
+    }
+    auto result = result_type();
+    auto rhs_it = std::ranges::begin(rhs);
+    for (auto&& value : lhs) {
+      assert(rhs_it != std::ranges::end(rhs));
+      result += static_cast<result_type>(value) *
+                static_cast<result_type>(*rhs_it++);
+    }
+    assert(rhs_it == std::ranges::end(rhs));
+    return result;
+  }
+}
+
+/*
+ * Smallest and largest elements of a non-empty range
+ */
+template <std::ranges::forward_range Range>
+std::ranges::minmax_result<std::ranges::range_value_t<Range>> minmax(
+    Range&& range) {
+  if constexpr (contiguous_kernel_range<Range>) {
+    return detail::minmax(std::ranges::data(range), std::ranges::ssize(range),
+                          detail::unit_stride());
+  } else if constexpr (strided_kernel_range<Range>) {
+    const auto span = detail::make_strided_span(range);
+    return detail::minmax(span.data, span.size, span.stride);
+  } else {
+    const auto [min, max] = std::ranges::minmax_element(range);
+    return {*min, *max};
+  }
+}
+
+}  // namespace matrix_views::kernels
@@ -0,0 +1,159 @@
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "kernels/dispatch.hpp"
+#include "kernels/reduce.hpp"
+#include "kernels/transform.hpp"
+
+namespace matrix_views::kernels {
+
+/*
+ * Concept representing a sized range that splits into spans of elements
+ * adjacent in memory, either contiguous as a whole or reporting the segment
+ * from any element on, e.g. a row of a tiled_matrix
+ */
+template <typename Range>
+concept segmented_kernel_range =
+    contiguous_kernel_range<Range> ||
+    (std::ranges::sized_range<Range> &&
+     requires(const std::remove_cvref_t<Range>& range, std::ptrdiff_t n) {
+       { range.segment(n) } -> std::ranges::contiguous_range;
+       { range.segment(n) } -> std::ranges::sized_range;
+     });
+
+namespace detail {
+
+/*
+ * Maximal segment from the n-th element on as a span
+ */
+template <segmented_kernel_range Range>
+constexpr auto segment(Range&& range, std::ptrdiff_t n) {
+  if constexpr (contiguous_kernel_range<Range>) {
+    return std::span(std::ranges::data(range) + n,
+                     static_cast<std::size_t>(std::ranges::ssize(range) - n));
+  } else {
+    return std::span(range.segment(n));
+  }
+}
+
+/*
+ * Segmented range whose segments can be written to
+ */
+template <typename Range>
+concept writable_segmented_kernel_range =
+    segmented_kernel_range<Range> &&
+    !std::is_const_v<typename decltype(segment(
+        std::declval<Range&>(), std::ptrdiff_t()))::element_type>;
+
+}  // namespace detail
+
+/*
+ * Calls the function with every segment of the range in order, as a
+ * std::span. Spans of ranges over caching storage proxies may be evicted
+ * once the function returns
+ */
+template <segmented_kernel_range Range, typename Function>
+void for_each_segment(Range&& range, Function function) {
+  const auto size = std::ranges::ssize(range);
+  for (std::ptrdiff_t n = 0; n < size;) {
+    const auto segment = detail::segment(range, n);
+    n += std::ssize(segment);
+    function(segment);
+  }
+}
+
+/*
+ * Copies the elements of the source range to the destination range, which
+ * must be at least as large as the source. Copies segment by segment, i.e.
+ * with memmove for trivially copyable elements, if both ranges are segmented
+ * and the segments of the destination are writable
+ */
+template <std::ranges::input_range Source, std::ranges::range Destination>
+  requires std::indirectly_copyable<std::ranges::iterator_t<Source>,
+                                    std::ranges::iterator_t<Destination>>
+void copy(Source&& source, Destination&& destination) {
+  if constexpr (contiguous_kernel_range<Source> &&
+                contiguous_kernel_range<Destination>) {
+    std::ranges::copy(source, std::ranges::data(destination));
+  } else if constexpr (strided_kernel_range<Source> &&
+                       strided_kernel_range<Destination>) {
+    const auto source_span = detail::make_strided_span(source);
+    const auto destination_span = detail::make_strided_span(destination);
+    detail::transform(source_span.data, source_span.stride,
+                      destination_span.data, destination_span.stride,
+                      source_span.size, std::identity());
+  } else if constexpr (segmented_kernel_range<Source> &&
+                       detail::writable_segmented_kernel_range<Destination>) {
+    auto destination_segment = decltype(detail::segment(destination, 0))();
+    std::ptrdiff_t n = 0;
+    for_each_segment(source, [&](auto segment) {
+      while (!segment.empty()) {
+        if (destination_segment.empty()) {
+          destination_segment = detail::segment(destination, n);
+        }
+        const auto count = std::min(segment.size(), destination_segment.size());
+        std::copy_n(segment.data(), count, destination_segment.data());
+        segment = segment.subspan(count);
+        destination_segment = destination_segment.subspan(count);
+        n += static_cast<std::ptrdiff_t>(count);
+      }
+    });
+  } else if constexpr (segmented_kernel_range<Source>) {
+    auto destination_it = std::ranges::begin(destination);
+    for_each_segment(source, [&](auto segment) {
+      destination_it = std::ranges::copy(segment, destination_it).out;
+    });
+  } else {
+    std::ranges::copy(source, std::ranges::begin(destination));
+  }
+}
+
+/*
+ * Reduction of the elements of the range with the operation, starting with
+ * the initial value. Assumes the operation to be associative and commutative
+ * and runs vectorized kernels per segment, so floating point results may
+ * differ from std::accumulate in the last bits
+ */
+template <std::ranges::input_range Range, typename T,
+          typename Operation = std::plus<>>
+T reduce(Range&& range, T init, Operation operation = {}) {
+  if constexpr (contiguous_kernel_range<Range>) {
+    return std::ranges::empty(range)
+               ? init
+               : static_cast<T>(operation(
+                     init, detail::reduce<T>(std::ranges::data(range),
+                                             std::ranges::ssize(range),
+                                             detail::unit_stride(),
+                                             operation)));
+  } else if constexpr (strided_kernel_range<Range>) {
+    const auto span = detail::make_strided_span(range);
+    return span.size == 0
+               ? init
+               : static_cast<T>(operation(
+                     init, detail::reduce<T>(span.data, span.size,
+                                             span.stride, operation)));
+  } else if constexpr (segmented_kernel_range<Range>) {
+    for_each_segment(range, [&](auto segment) {
+      init = static_cast<T>(
+          operation(init, detail::reduce<T>(segment.data(),
+                                            std::ssize(segment),
+                                            detail::unit_stride(), operation)));
+    });
+    return init;
+  } else {
+    for (auto&& value : range) {
+      init = static_cast<T>(operation(init, value));
+    }
+    return init;
+  }
+}
+
+}  // namespace matrix_views::kernels
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <iterator>
+#include <ranges>
+
+#include "kernels/dispatch.hpp"
+
+namespace matrix_views::kernels {
+
+namespace detail {
+
+template <typename T, typename U, typename SourceStride,
+          typename DestinationStride, typename Function>
+MATRIX_VIEWS_TARGET_CLONES void transform(const T* source,
+                                          SourceStride source_stride,
+                                          U* destination,
+                                          DestinationStride destination_stride,
+                                          std::ptrdiff_t size,
+                                          Function function) {
+  for (std::ptrdiff_t i = 0; i < size; ++i) {
+    destination[i * destination_stride] = function(source[i * source_stride]);
+  }
+}
+
+template <typename T, typename Stride>
+MATRIX_VIEWS_TARGET_CLONES void fill(T* data, std::ptrdiff_t size,
+                                     Stride stride, const T value) noexcept {
+  for (std::ptrdiff_t i = 0; i < size; ++i) {
+    data[i * stride] = value;
+  }
+}
+
+}  // namespace detail
+
+/*
+ * Writes the function of every element of the source range to the
+ * destination range, which must be at least as large as the source
+ */
+template <std::ranges::input_range Source, std::ranges::range Destination,
+          typename Function>
+void transform(Source&& source, Destination&& destination, Function function) {
+  if constexpr (contiguous_kernel_range<Source> &&
+                contiguous_kernel_range<Destination>) {
+    detail::transform(std::ranges::data(source), detail::unit_stride(),
+                      std::ranges::data(destination), detail::unit_stride(),
+                      std::ranges::ssize(source), std::move(function));
+  } else if constexpr (strided_kernel_range<Source> &&
+                       strided_kernel_range<Destination>) {
+    const auto source_span = detail::make_strided_span(source);
+    const auto destination_span = detail::make_strided_span(destination);
+    detail::transform(source_span.data, source_span.stride,
+                      destination_span.data, destination_span.stride,
+                      source_span.size, std::move(function));
+  } else {
+    auto destination_it = std::ranges::begin(destination);
+    for (auto&& value : source) {
+      *destination_it++ = function(value);
+    }
+  }
+}
+
+/*
+ * Assigns the value to every element of the range
+ */
+template <std::ranges::range Range, typename T>
+void fill(Range&& range, const T& value) {
+  if constexpr (contiguous_kernel_range<Range>) {
+    detail::fill(std::ranges::data(range), std::ranges::ssize(range),
+                 detail::unit_stride(),
+                 static_cast<std::ranges::range_value_t<Range>>(value));
+  } else if constexpr (strided_kernel_range<Range>) {
+    const auto span = detail::make_strided_span(range);
+    detail::fill(span.data, span.size, span.stride,
+                 static_cast<std::ranges::range_value_t<Range>>(value));
+  } else {
+    for (auto&& element : range) {
+      element = value;
+    }
+  }
+}
+
+}  // namespace matrix_views::kernels
@@ -0,0 +1,464 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#include "matrices/matrix_view.hpp"
+#include "utils/index.hpp"
+#include "utils/tags.hpp"
+
+namespace matrix_views::kernels {
+
+/*
+ * Concept representing a matrix with dimensions and a storage proxy, e.g.
+ * matrix or matrix_view
+ */
+template <typename Matrix>
+concept transpose_matrix = requires(Matrix& matrix, utils::index index) {
+  { matrix.rows() } -> std::convertible_to<std::size_t>;
+  { matrix.columns() } -> std::convertible_to<std::size_t>;
+  { matrix.storage()(index) };
+};
+
+/*
+ * Concept representing a storage proxy over a pointer with constant offsets
+ * between adjacent cells of rows and columns, e.g. strided_storage_proxy
+ */
+template <typename StorageProxy>
+concept transpose_strided_storage_proxy =
+    requires(const StorageProxy storage_proxy) {
+      { storage_proxy.data() } -> std::same_as<typename StorageProxy::pointer>;
+      { storage_proxy.stride(utils::kRow) } -> std::same_as<std::ptrdiff_t>;
+      { storage_proxy.stride(utils::kColumn) } -> std::same_as<std::ptrdiff_t>;
+    };
+
+/*
+ * Concept representing a matrix that may be square as far as the dimensions
+ * set in its type tell
+ */
+template <typename Matrix>
+concept transpose_square_matrix =
+    transpose_matrix<Matrix> &&
+    (!matrices::matrix_view_operand<Matrix&> ||
+     matrices::kRowsOf<Matrix&> == std::dynamic_extent ||
+     matrices::kColumnsOf<Matrix&> == std::dynamic_extent ||
+     matrices::kRowsOf<Matrix&> == matrices::kColumnsOf<Matrix&>);
+
+namespace detail {
+
+/*
+ * Whether the destination may hold the transpose of the source as far as the
+ * dimensions set in their types tell
+ */
+template <typename Source, typename Destination>
+constexpr bool transposed_extents() noexcept {
+  if constexpr (matrices::matrix_view_operand<Source&> &&
+                matrices::matrix_view_operand<Destination&>) {
+    return matrices::detail::same_extent(matrices::kRowsOf<Destination&>,
+                                         matrices::kColumnsOf<Source&>) &&
+           matrices::detail::same_extent(matrices::kColumnsOf<Destination&>,
+                                         matrices::kRowsOf<Source&>);
+  } else {
+    return true;
+  }
+}
+
+/*
+ * Side of the blocks that the recursion stops at. A pair of blocks of
+ * doubles fits into L1
+ */
+inline constexpr std::ptrdiff_t kTransposeBlock = 32;
+
+/*
+ * Side of the micro-kernels that transpose blocks of dense storage in vector
+ * registers
+ */
+inline constexpr std::ptrdiff_t kMicroKernel = 8;
+
+/*
+ * Whether the micro-kernels move elements of the type, which they do as
+ * 32-bit or 64-bit lanes of SSE2, or AVX if enabled at compile time
+ */
+template <typename T, typename U>
+inline constexpr bool kMicroKernelType =
+#if defined(__SSE2__)
+    std::is_same_v<std::remove_const_t<T>, U> &&
+    std::is_trivially_copyable_v<U> && (sizeof(U) == 4 || sizeof(U) == 8);
+#else
+    false;
+#endif
+
+#if defined(__SSE2__)
+
+/*
+ * Transposes the 8x8 block of rows source_stride elements apart to the one
+ * of rows destination_stride elements apart. The intrinsics load through
+ * may-alias vector types, so any 32-bit or 64-bit element type will do
+ */
+template <typename T>
+[[gnu::always_inline]] inline void transpose_8x8(
+    const T* source, std::ptrdiff_t source_stride, T* destination,
+    std::ptrdiff_t destination_stride) noexcept {
+  if constexpr (sizeof(T) == 4) {
+    const auto* from = reinterpret_cast<const float*>(source);
+    auto* to = reinterpret_cast<float*>(destination);
+#if defined(__AVX__)
+    __m256 r[8], t[8];
+    for (std::ptrdiff_t i = 0; i < 8; ++i) {
+      r[i] = _mm256_loadu_ps(from + i * source_stride);
+    }
+    for (std::ptrdiff_t i = 0; i < 8; i += 2) {
+      t[i] = _mm256_unpacklo_ps(r[i], r[i + 1]);
+      t[i + 1] = _mm256_unpackhi_ps(r[i], r[i + 1]);
+    }
+    for (std::ptrdiff_t i = 0; i < 8; i += 4) {
+      r[i] = _mm256_shuffle_ps(t[i], t[i + 2], _MM_SHUFFLE(1, 0, 1, 0));
+      r[i + 1] = _mm256_shuffle_ps(t[i], t[i + 2], _MM_SHUFFLE(3, 2, 3, 2));
+      r[i + 2] = _mm256_shuffle_ps(t[i + 1], t[i + 3], _MM_SHUFFLE(1, 0, 1, 0));
+      r[i + 3] = _mm256_shuffle_ps(t[i + 1], t[i + 3], _MM_SHUFFLE(3, 2, 3, 2));
+    }
+    for (std::ptrdiff_t i = 0; i < 4; ++i) {
+      _mm256_storeu_ps(to + i * destination_stride,
+                       _mm256_permute2f128_ps(r[i], r[i + 4], 0x20));
+      _mm256_storeu_ps(to + (i + 4) * destination_stride,
+                       _mm256_permute2f128_ps(r[i], r[i + 4], 0x31));
+    }
+#else
+    for (std::ptrdiff_t i = 0; i < 8; i += 4) {
+      for (std::ptrdiff_t j = 0; j < 8; j += 4) {
+        const auto* block = from + i * source_stride + j;
+        __m128 r0 = _mm_loadu_ps(block);
+        __m128 r1 = _mm_loadu_ps(block + source_stride);
+        __m128 r2 = _mm_loadu_ps(block + 2 * source_stride);
+        __m128 r3 = _mm_loadu_ps(block + 3 * source_stride);
+        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+        auto* transposed = to + j * destination_stride + i;
+        _mm_storeu_ps(transposed, r0);
+        _mm_storeu_ps(transposed + destination_stride, r1);
+        _mm_storeu_ps(transposed + 2 * destination_stride, r2);
+        _mm_storeu_ps(transposed + 3 * destination_stride, r3);
+      }
+    }
+#endif
+  } else {
+    static_assert(sizeof(T) == 8);
+    const auto* from = reinterpret_cast<const double*>(source);
+    auto* to = reinterpret_cast<double*>(destination);
+#if defined(__AVX__)
+    for (std::ptrdiff_t i = 0; i < 8; i += 4) {
+      for (std::ptrdiff_t j = 0; j < 8; j += 4) {
+        const auto* block = from + i * source_stride + j;
+        __m256d r[4], t[4];
+        for (std::ptrdiff_t k = 0; k < 4; ++k) {
+          r[k] = _mm256_loadu_pd(block + k * source_stride);
+        }
+        t[0] = _mm256_unpacklo_pd(r[0], r[1]);
+        t[1] = _mm256_unpackhi_pd(r[0], r[1]);
+        t[2] = _mm256_unpacklo_pd(r[2], r[3]);
+        t[3] = _mm256_unpackhi_pd(r[2], r[3]);
+        auto* transposed = to + j * destination_stride + i;
+        _mm256_storeu_pd(transposed, _mm256_permute2f128_pd(t[0], t[2], 0x20));
+        _mm256_storeu_pd(transposed + destination_stride,
+                         _mm256_permute2f128_pd(t[1], t[3], 0x20));
+        _mm256_storeu_pd(transposed + 2 * destination_stride,
+                         _mm256_permute2f128_pd(t[0], t[2], 0x31));
+        _mm256_storeu_pd(transposed + 3 * destination_stride,
+                         _mm256_permute2f128_pd(t[1], t[3], 0x31));
+      }
+    }
+#else
+    for (std::ptrdiff_t i = 0; i < 8; i += 2) {
+      for (std::ptrdiff_t j = 0; j < 8; j += 2) {
+        const auto* block = from + i * source_stride + j;
+        const __m128d r0 = _mm_loadu_pd(block);
+        const __m128d r1 = _mm_loadu_pd(block + source_stride);
+        auto* transposed = to + j * destination_stride + i;
+        _mm_storeu_pd(transposed, _mm_unpacklo_pd(r0, r1));
+        _mm_storeu_pd(transposed + destination_stride, _mm_unpackhi_pd(r0, r1));
+      }
+    }
+#endif
+  }
+}
+
+#endif
+
+/*
+ * Writes the element at {i, j} of the rows x columns source to {j, i} of the
+ * destination, both given by a pointer and the strides between rows and
+ * columns. Halves the longer side until the blocks fit into the cache, so the
+ * copy misses the cache as rarely as a copy tuned for the cache size would
+ *
+ * With Dense set both column strides are 1 and the blocks run through the
+ * micro-kernels
+ */
+template <bool Dense, typename T, typename U>
+void transpose_blocks(const T* source, std::ptrdiff_t source_row_stride,
+                      std::ptrdiff_t source_column_stride, U* destination,
+                      std::ptrdiff_t destination_row_stride,
+                      std::ptrdiff_t destination_column_stride,
+                      std::ptrdiff_t rows, std::ptrdiff_t columns) {
+  if (rows <= kTransposeBlock && columns <= kTransposeBlock) {
+    std::ptrdiff_t i = 0;
+    if constexpr (Dense) {
+      const auto full_columns = columns - columns % kMicroKernel;
+      for (; i + kMicroKernel <= rows; i += kMicroKernel) {
+        for (std::ptrdiff_t j = 0; j < full_columns; j += kMicroKernel) {
+          transpose_8x8(source + i * source_row_stride + j,
+                        source_row_stride,
+                        destination + j * destination_row_stride + i,
+                        destination_row_stride);
+        }
+        for (auto k = i; k < i + kMicroKernel; ++k) {
+          for (auto j = full_columns; j < columns; ++j) {
+            destination[j * destination_row_stride + k] =
+                source[k * source_row_stride + j];
+          }
+        }
+      }
+    }
+    for (; i < rows; ++i) {
+      for (std::ptrdiff_t j = 0; j < columns; ++j) {
+        destination[j * destination_row_stride +
+                    i * destination_column_stride] =
+            source[i * source_row_stride + j * source_column_stride];
+      }
+    }
+  } else if (rows >= columns) {
+    const auto half = rows / 2 / kMicroKernel * kMicroKernel;
+    transpose_blocks<Dense>(source, source_row_stride, source_column_stride,
+                            destination, destination_row_stride,
+                            destination_column_stride, half, columns);
+    transpose_blocks<Dense>(source + half * source_row_stride,
+                            source_row_stride, source_column_stride,
+                            destination + half * destination_column_stride,
+                            destination_row_stride, destination_column_stride,
+                            rows - half, columns);
+  } else {
+    const auto half = columns / 2 / kMicroKernel * kMicroKernel;
+    transpose_blocks<Dense>(source, source_row_stride, source_column_stride,
+                            destination, destination_row_stride,
+                            destination_column_stride, rows, half);
+    transpose_blocks<Dense>(source + half * source_column_stride,
+                            source_row_stride, source_column_stride,
+                            destination + half * destination_row_stride,
+                            destination_row_stride, destination_column_stride,
+                            rows, columns - half);
+  }
+}
+
+/*
+ * Strided transpose. Picks the micro-kernels if both matrices are dense
+ * row by row
+ */
+template <typename T, typename U>
+void transpose(const T* source, std::ptrdiff_t source_row_stride,
+               std::ptrdiff_t source_column_stride, U* destination,
+               std::ptrdiff_t destination_row_stride,
+               std::ptrdiff_t destination_column_stride, std::ptrdiff_t rows,
+               std::ptrdiff_t columns) {
+  if constexpr (kMicroKernelType<T, U>) {
+    if (source_column_stride == 1 && destination_column_stride == 1) {
+      transpose_blocks<true>(source, source_row_stride, 1, destination,
+                             destination_row_stride, 1, rows, columns);
+      return;
+    }
+  }
+  transpose_blocks<false>(source, source_row_stride, source_column_stride,
+                          destination, destination_row_stride,
+                          destination_column_stride, rows, columns);
+}
+
+/*
+ * Transpose of the rows x columns block at the origin of the source through
+ * the storage proxies, with the same recursion as the strided one
+ */
+template <typename Source, typename Destination>
+void transpose_cells(const Source& source, const Destination& destination,
+                     utils::index origin, std::ptrdiff_t rows,
+                     std::ptrdiff_t columns) {
+  if (rows <= kTransposeBlock && columns <= kTransposeBlock) {
+    for (auto i = origin.row; i < origin.row + rows; ++i) {
+      for (auto j = origin.column; j < origin.column + columns; ++j) {
+        destination({j, i}) = source({i, j});
+      }
+    }
+  } else if (rows >= columns) {
+    const auto half = rows / 2;
+    transpose_cells(source, destination, origin, half, columns);
+    transpose_cells(source, destination,
+                    {origin.row + half, origin.column}, rows - half,
+                    columns);
+  } else {
+    const auto half = columns / 2;
+    transpose_cells(source, destination, origin, rows, half);
+    transpose_cells(source, destination,
+                    {origin.row, origin.column + half}, rows,
+                    columns - half);
+  }
+}
+
+/*
+ * Transposes the rows [first, last) of the source into the columns of the
+ * destination
+ */
+template <typename Source, typename Destination>
+void transpose_rows(const Source& source, const Destination& destination,
+                    std::ptrdiff_t columns, std::ptrdiff_t first,
+                    std::ptrdiff_t last) {
+  if constexpr (transpose_strided_storage_proxy<Source> &&
+                transpose_strided_storage_proxy<Destination>) {
+    const auto source_row_stride = source.stride(utils::kColumn);
+    const auto destination_column_stride = destination.stride(utils::kRow);
+    transpose(source.data() + first * source_row_stride, source_row_stride,
+              source.stride(utils::kRow),
+              destination.data() + first * destination_column_stride,
+              destination.stride(utils::kColumn), destination_column_stride,
+              last - first, columns);
+  } else {
+    transpose_cells(source, destination, {first, 0}, last - first, columns);
+  }
+}
+
+/*
+ * Swaps the element at {i, j} of the rows x columns block at lhs with the
+ * one at {j, i} of the block at rhs, recursing like transpose_blocks
+ */
+template <typename T>
+void transpose_swap(T* lhs, T* rhs, std::ptrdiff_t row_stride,
+                    std::ptrdiff_t column_stride, std::ptrdiff_t rows,
+                    std::ptrdiff_t columns) {
+  if (rows <= kTransposeBlock && columns <= kTransposeBlock) {
+    for (std::ptrdiff_t i = 0; i < rows; ++i) {
+      for (std::ptrdiff_t j = 0; j < columns; ++j) {
+        std::swap(lhs[i * row_stride + j * column_stride],
+                  rhs[j * row_stride + i * column_stride]);
+      }
+    }
+  } else if (rows >= columns) {
+    const auto half = rows / 2;
+    transpose_swap(lhs, rhs, row_stride, column_stride, half, columns);
+    transpose_swap(lhs + half * row_stride, rhs + half * column_stride,
+                   row_stride, column_stride, rows - half, columns);
+  } else {
+    const auto half = columns / 2;
+    transpose_swap(lhs, rhs, row_stride, column_stride, rows, half);
+    transpose_swap(lhs + half * column_stride, rhs + half * row_stride,
+                   row_stride, column_stride, rows, columns - half);
+  }
+}
+
+/*
+ * In-place transpose of the n x n block. Transposes the diagonal quadrants
+ * and swaps the off-diagonal ones with each other's transpose
+ */
+template <typename T>
+void transpose_square(T* data, std::ptrdiff_t row_stride,
+                      std::ptrdiff_t column_stride, std::ptrdiff_t n) {
+  if (n <= kTransposeBlock) {
+    for (std::ptrdiff_t i = 0; i < n; ++i) {
+      for (std::ptrdiff_t j = i + 1; j < n; ++j) {
+        std::swap(data[i * row_stride + j * column_stride],
+                  data[j * row_stride + i * column_stride]);
+      }
+    }
+    return;
+  }
+
+  const auto half = n / 2;
+  transpose_square(data, row_stride, column_stride, half);
+  transpose_square(data + half * (row_stride + column_stride), row_stride,
+                   column_stride, n - half);
+  transpose_swap(data + half * column_stride, data + half * row_stride,
+                 row_stride, column_stride, half, n - half);
+}
+
+}  // namespace detail
+
+/*
+ * Writes the transpose of the source matrix to the destination, which must
+ * have as many rows as the source has columns and vice versa. Recurses into
+ * blocks that fit into the cache whatever its size and runs SIMD
+ * micro-kernels over dense storage, e.g. between two row-major matrices. The
+ * matrices must not overlap
+ */
+template <transpose_matrix Source, transpose_matrix Destination>
+void transpose(const Source& source, Destination&& destination) {
+  static_assert(
+      detail::transposed_extents<Source, std::remove_cvref_t<Destination>>(),
+      "the destination must have the dimensions of the transposed source");
+  assert(destination.rows() == source.columns() &&
+         destination.columns() == source.rows());
+  detail::transpose_rows(source.storage(), destination.storage(),
+                         static_cast<std::ptrdiff_t>(source.columns()), 0,
+                         static_cast<std::ptrdiff_t>(source.rows()));
+}
+
+/*
+ * In-place transpose of a square matrix over a strided storage proxy. The
+ * matrix keeps its dimensions, so rectangular ones are rejected, at compile
+ * time if the dimensions are set in the type
+ */
+template <typename Matrix>
+  requires transpose_square_matrix<std::remove_cvref_t<Matrix>> &&
+           transpose_strided_storage_proxy<
+               decltype(std::declval<Matrix&>().storage())>
+void transpose_in_place(Matrix&& matrix) {
+  assert(matrix.rows() == matrix.columns());
+  const auto storage_proxy = matrix.storage();
+  detail::transpose_square(storage_proxy.data(),
+                           storage_proxy.stride(utils::kColumn),
+                           storage_proxy.stride(utils::kRow),
+                           static_cast<std::ptrdiff_t>(matrix.rows()));
+}
+
+/*
+ * In-place transpose of the rows x columns matrix stored row by row in the
+ * data, which then stores the columns x rows transpose row by row. Square
+ * matrices are transposed blockwise. Others follow the cycles of the
+ * permutation, which takes a bit per element and misses the cache more
+ */
+template <typename T>
+void transpose_in_place(std::span<T> data, std::size_t rows,
+                        std::size_t columns) {
+  assert(data.size() == rows * columns);
+  if (rows == columns) {
+    detail::transpose_square(data.data(), static_cast<std::ptrdiff_t>(columns),
+                             1, static_cast<std::ptrdiff_t>(rows));
+    return;
+  }
+  if (rows <= 1 || columns <= 1) {
+    return;
+  }
+
+  // The element at i * columns + j moves to j * rows + i
+  const auto destination = [rows, columns](std::size_t position) {
+    return position % columns * rows + position / columns;
+  };
+  const auto size = rows * columns;
+  std::vector<bool> visited(size);
+  for (std::size_t start = 1; start + 1 < size; ++start) {
+    if (visited[start]) {
+      continue;
+    }
+    auto value = std::move(data[start]);
+    auto position = start;
+    do {
+      position = destination(position);
+      std::swap(value, data[position]);
+      visited[position] = true;
+    } while (position != start);
+  }
+}
+
+}  // namespace matrix_views::kernels
@@ -0,0 +1,326 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "kernels/transpose.hpp"
+#include "matrices/base_matrix.hpp"
+#include "ranges/stripe_random_access_range.hpp"
+#include "ranges/tagged_random_access_range.hpp"
+#include "storage/strided_storage_proxy.hpp"
+#include "utils/aligned_allocator.hpp"
+#include "utils/index.hpp"
+#include "utils/tags.hpp"
+
+namespace matrix_views::matrices {
+
+/*
+ * Read-only dense matrix that moves its elements between the row-major and
+ * the column-major layout to follow the traversals of the recent past
+ *
+ * Counts the elements of the ranges handed out per direction. Once a window
+ * of that many elements has been handed out and one of rows or columns took
+ * at least 3/4 of them while the other layout is in use, a background thread
+ * transposes the elements into the better layout and swaps the storage
+ * atomically. Diagonals and antidiagonals are as strided in either layout,
+ * so they only dilute the counts
+ *
+ * Ranges are handed out by snapshots, which keep the storage they were taken
+ * with alive. Snapshots taken before a swap stay valid and keep reading the
+ * old layout, so take a new snapshot per phase. Ranges read the storage of
+ * their snapshot, so they must not outlive it and temporary snapshots hand
+ * out none. Snapshots may outlive the matrix and stop reporting their ranges
+ * then
+ */
+template <typename T>
+class adaptive_matrix final {
+ private:
+  struct buffer final {
+    bool row_major;
+    std::vector<T, utils::aligned_allocator<T>> data;
+  };
+
+  enum direction : std::size_t { kRows, kColumns, kOthers };
+
+  /*
+   * Storage and traversal counts shared by the matrix and its snapshots
+   */
+  class state final {
+   public:
+    state(std::size_t rows, std::size_t columns, std::uint64_t window,
+          std::shared_ptr<const buffer> initial)
+        : rows_(rows), columns_(columns), window_(window) {
+      buffer_.store(std::move(initial));
+    }
+
+    ~state() { wait(); }
+
+   public:
+    std::shared_ptr<const buffer> current() const { return buffer_.load(); }
+
+    void wait() {
+      const std::lock_guard lock(mutex_);
+      if (worker_.joinable()) {
+        worker_.join();
+      }
+    }
+
+    void record(direction direction, std::size_t elements) {
+      counts_[direction].fetch_add(elements, std::memory_order_relaxed);
+      if (total_.fetch_add(elements, std::memory_order_relaxed) + elements <
+          window_) {
+        return;
+      }
+
+      const std::unique_lock lock(mutex_, std::try_to_lock);
+      if (!lock.owns_lock() ||
+          total_.load(std::memory_order_relaxed) < window_) {
+        return;
+      }
+
+      total_.store(0, std::memory_order_relaxed);
+      auto counts = std::array<std::uint64_t, 3>();
+      for (std::size_t i = 0; i < counts.size(); ++i) {
+        counts[i] = counts_[i].exchange(0, std::memory_order_relaxed);
+      }
+      const auto total = counts[kRows] + counts[kColumns] + counts[kOthers];
+      const auto dominant = [total](std::uint64_t count) {
+        return 4 * count >= 3 * total;
+      };
+
+      if (relayout_.load(std::memory_order_acquire)) {
+        return;
+      }
+      const auto row_major = buffer_.load()->row_major;
+      if (row_major ? dominant(counts[kColumns]) : dominant(counts[kRows])) {
+        if (worker_.joinable()) {
+          worker_.join();
+        }
+        relayout_.store(true, std::memory_order_release);
+        worker_ = std::thread([this] { relayout(); });
+      }
+    }
+
+   private:
+    /*
+     * Transposes the elements into the other layout and publishes them
+     */
+    void relayout() {
+      const auto source = buffer_.load();
+      auto destination = std::make_shared<buffer>();
+      destination->row_major = !source->row_major;
+      destination->data.resize(source->data.size());
+
+      // Stored rows of the source become stored columns of the destination
+      const auto stored_rows = static_cast<std::ptrdiff_t>(
+          source->row_major ? rows_ : columns_);
+      const auto stored_columns = static_cast<std::ptrdiff_t>(
+          source->row_major ? columns_ : rows_);
+      kernels::detail::transpose(source->data.data(), stored_columns, 1,
+                                 destination->data.data(), stored_rows, 1,
+                                 stored_rows, stored_columns);
+
+      buffer_.store(std::move(destination));
+      relayout_.store(false, std::memory_order_release);
+    }
+
+   private:
+    std::size_t rows_;
+    std::size_t columns_;
+    std::uint64_t window_;
+
+    std::atomic<std::shared_ptr<const buffer>> buffer_;
+
+    std::array<std::atomic<std::uint64_t>, 3> counts_{};
+    std::atomic<std::uint64_t> total_ = 0;
+
+    std::mutex mutex_;
+    std::thread worker_;
+    std::atomic<bool> relayout_ = false;
+  };
+
+ public:
+  using value_type = T;
+
+  using storage_proxy = storage::strided_storage_proxy<const T>;
+
+  template <typename Tag>
+  using range = ranges::tagged_random_access_range<Tag, storage_proxy>;
+  template <typename Tag>
+  using stripe_range = ranges::stripe_random_access_range<Tag, storage_proxy>;
+
+  /*
+   * Matrix as of one layout. Hands out the same tagged ranges as matrix and
+   * reports them to the adaptive matrix it was taken from. The ranges and
+   * the storage proxy point into the storage that the snapshot owns, so
+   * temporary snapshots hand out neither
+   */
+  class snapshot final : private base_matrix<snapshot> {
+   private:
+    using base = base_matrix<snapshot>;
+
+   public:
+    std::size_t rows() const noexcept { return rows_; }
+    std::size_t columns() const noexcept { return columns_; }
+    bool row_major() const noexcept { return buffer_->row_major; }
+
+    const T& operator()(utils::index index) const& {
+      return storage()(index);
+    }
+    const T& operator()(utils::index index) const&& = delete;
+
+    storage_proxy storage() const& noexcept {
+      return buffer_->row_major
+                 ? storage_proxy(buffer_->data.data(), columns(), 1)
+                 : storage_proxy(buffer_->data.data(), 1, rows());
+    }
+    storage_proxy storage() const&& = delete;
+
+    decltype(auto) row(std::ptrdiff_t i) const& { return base::row(i); }
+    decltype(auto) row(std::ptrdiff_t i) const&& = delete;
+
+    decltype(auto) column(std::ptrdiff_t j) const& { return base::column(j); }
+    decltype(auto) column(std::ptrdiff_t j) const&& = delete;
+
+    decltype(auto) diagonal(std::ptrdiff_t k) const& {
+      return base::diagonal(k);
+    }
+    decltype(auto) diagonal(std::ptrdiff_t k) const&& = delete;
+
+    decltype(auto) antidiagonal(std::ptrdiff_t k) const& {
+      return base::antidiagonal(k);
+    }
+    decltype(auto) antidiagonal(std::ptrdiff_t k) const&& = delete;
+
+    template <ranges::tagged_random_access_range_tag Tag>
+    decltype(auto) stripes(Tag) const& {
+      return base::stripes(Tag{});
+    }
+    template <ranges::tagged_random_access_range_tag Tag>
+    decltype(auto) stripes(Tag) const&& = delete;
+
+    template <std::size_t TileSize>
+      requires(TileSize != std::dynamic_extent)
+    decltype(auto) tiles() const& {
+      return base::template tiles<TileSize>();
+    }
+    template <std::size_t TileSize>
+      requires(TileSize != std::dynamic_extent)
+    decltype(auto) tiles() const&& = delete;
+
+    template <std::size_t TileSize = std::dynamic_extent>
+    decltype(auto) tiles(std::size_t tile_size) const& {
+      return base::template tiles<TileSize>(tile_size);
+    }
+    template <std::size_t TileSize = std::dynamic_extent>
+    decltype(auto) tiles(std::size_t tile_size) const&& = delete;
+
+    template <iterators::curve_random_access_iterator_tag Tag>
+    decltype(auto) cells(Tag) const& {
+      return base::cells(Tag{});
+    }
+    template <iterators::curve_random_access_iterator_tag Tag>
+    decltype(auto) cells(Tag) const&& = delete;
+
+   private:
+    friend class adaptive_matrix;
+    friend class base_matrix<snapshot>;
+
+    snapshot(std::size_t rows, std::size_t columns,
+             std::weak_ptr<state> state,
+             std::shared_ptr<const buffer> buffer) noexcept
+        : rows_(rows),
+          columns_(columns),
+          state_(std::move(state)),
+          buffer_(std::move(buffer)) {}
+
+    /*
+     * Reports every range handed out to the matrix unless it is gone.
+     * Diagonals, antidiagonals, tiles and curves count as the others
+     */
+    template <typename Tag>
+    void record(Tag, std::size_t elements) const {
+      if (const auto state = state_.lock()) {
+        state->record(std::is_same_v<Tag, utils::kRowTag>      ? kRows
+                      : std::is_same_v<Tag, utils::kColumnTag> ? kColumns
+                                                               : kOthers,
+                      elements);
+      }
+    }
+
+   private:
+    std::size_t rows_;
+    std::size_t columns_;
+    std::weak_ptr<state> state_;
+    std::shared_ptr<const buffer> buffer_;
+  };
+
+ public:
+  /*
+   * Copies the elements of the matrix in row-major order. The window
+   * defaults to twice the number of elements
+   */
+  template <typename Matrix>
+    requires requires(const Matrix& matrix, utils::index index) {
+      { matrix.rows() } -> std::convertible_to<std::size_t>;
+      { matrix.columns() } -> std::convertible_to<std::size_t>;
+      { matrix(index) } -> std::convertible_to<T>;
+    }
+  explicit adaptive_matrix(const Matrix& matrix, std::size_t window = 0)
+      : rows_(matrix.rows()), columns_(matrix.columns()) {
+    auto initial = std::make_shared<buffer>();
+    initial->row_major = true;
+    initial->data.reserve(rows_ * columns_);
+    for (std::size_t i = 0; i < rows_; ++i) {
+      for (std::size_t j = 0; j < columns_; ++j) {
+        initial->data.push_back(static_cast<T>(
+            matrix(utils::index{static_cast<std::ptrdiff_t>(i),
+                                static_cast<std::ptrdiff_t>(j)})));
+      }
+    }
+    state_ = std::make_shared<state>(
+        rows_, columns_, window != 0 ? window : 2 * rows_ * columns_,
+        std::move(initial));
+  }
+
+  adaptive_matrix(const adaptive_matrix&) = delete;
+  adaptive_matrix& operator=(const adaptive_matrix&) = delete;
+
+  ~adaptive_matrix() { wait(); }
+
+ public:
+  std::size_t rows() const noexcept { return rows_; }
+  std::size_t columns() const noexcept { return columns_; }
+  std::size_t size() const noexcept { return rows_ * columns_; }
+
+  /*
+   * Layout of the storage that new snapshots are taken with
+   */
+  bool row_major() const noexcept { return state_->current()->row_major; }
+
+  snapshot take_snapshot() const {
+    return snapshot(rows_, columns_, state_, state_->current());
+  }
+
+  /*
+   * Blocks until the running relayout, if any, has swapped the storage
+   */
+  void wait() const { state_->wait(); }
+
+ private:
+  std::size_t rows_;
+  std::size_t columns_;
+
+  std::shared_ptr<state> state_;
+};
+
+}  // namespace matrix_views::matrices
@@ -0,0 +1,203 @@
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <iterator>
+#include <span>
+
+#include "ranges/curve_random_access_range.hpp"
+#include "ranges/stripe_random_access_range.hpp"
+#include "ranges/tagged_random_access_range.hpp"
+#include "ranges/tile_random_access_range.hpp"
+#include "utils/index.hpp"
+#include "utils/tags.hpp"
+
+namespace matrix_views::matrices {
+
+/*
+ * Concept representing a type that inherits base_matrix and implements its
+ * CRTP interface
+ */
+template <typename CRTP>
+concept base_matrix_crtp = requires(const CRTP crtp) {
+  { crtp.rows() } -> std::convertible_to<std::size_t>;
+  { crtp.columns() } -> std::convertible_to<std::size_t>;
+  { crtp.storage() } -> ranges::tagged_random_access_range_storage_proxy;
+};
+
+/*
+ * Base matrix class intended for internal use. Constructible only from
+ * derived types
+ *
+ * Hands out the tagged, stripe, tile and curve ranges over the storage proxy
+ * returned by storage(), with the dimensions set in the type if any. Ranges
+ * taken from a non-const matrix are built over its non-const storage proxy.
+ * Tagged and stripe ranges hand out iterators with index components of the
+ * Index type
+ *
+ * Derived types that track their traversals may implement record(Tag, size)
+ * to be called with every range handed out and its number of elements
+ */
+template <typename CRTP, std::size_t Rows = std::dynamic_extent,
+          std::size_t Columns = std::dynamic_extent,
+          utils::index_integral Index = utils::default_index_t<Rows, Columns>>
+class base_matrix {
+ protected:
+  constexpr base_matrix() noexcept {
+    static_assert(base_matrix_crtp<CRTP>,
+                  "a type derived from base_matrix must implement the "
+                  "base_matrix_crtp concept");
+  }
+
+  template <typename Tag>
+  constexpr void record(Tag, std::size_t) const noexcept {}
+
+ private:
+  constexpr CRTP& crtp_cast() noexcept { return static_cast<CRTP&>(*this); }
+  constexpr const CRTP& crtp_cast() const noexcept {
+    return static_cast<const CRTP&>(*this);
+  }
+
+ public:
+  constexpr decltype(auto) row(std::ptrdiff_t i) {
+    return make_range(crtp_cast(), utils::kRow, {i, 0});
+  }
+  constexpr decltype(auto) row(std::ptrdiff_t i) const {
+    return make_range(crtp_cast(), utils::kRow, {i, 0});
+  }
+
+  constexpr decltype(auto) column(std::ptrdiff_t j) {
+    return make_range(crtp_cast(), utils::kColumn, {0, j});
+  }
+  constexpr decltype(auto) column(std::ptrdiff_t j) const {
+    return make_range(crtp_cast(), utils::kColumn, {0, j});
+  }
+
+  /*
+   * k-th diagonal. The main diagonal is 0, diagonals above it are positive
+   */
+  constexpr decltype(auto) diagonal(std::ptrdiff_t k) {
+    return make_range(crtp_cast(), utils::kDiagonal, diagonal_start(k));
+  }
+  constexpr decltype(auto) diagonal(std::ptrdiff_t k) const {
+    return make_range(crtp_cast(), utils::kDiagonal, diagonal_start(k));
+  }
+
+  /*
+   * k-th antidiagonal, i.e. the cells with row + column == k
+   */
+  constexpr decltype(auto) antidiagonal(std::ptrdiff_t k) {
+    return make_range(crtp_cast(), utils::kAntidiagonal,
+                      antidiagonal_start(k));
+  }
+  constexpr decltype(auto) antidiagonal(std::ptrdiff_t k) const {
+    return make_range(crtp_cast(), utils::kAntidiagonal,
+                      antidiagonal_start(k));
+  }
+
+  /*
+   * Range of all stripes of the matrix in the direction of the tag
+   */
+  template <ranges::tagged_random_access_range_tag Tag>
+  constexpr decltype(auto) stripes(Tag) {
+    return make_stripes(crtp_cast(), Tag{});
+  }
+  template <ranges::tagged_random_access_range_tag Tag>
+  constexpr decltype(auto) stripes(Tag) const {
+    return make_stripes(crtp_cast(), Tag{});
+  }
+
+  /*
+   * Range of all square tiles of the matrix of the size set in the type
+   */
+  template <std::size_t TileSize>
+    requires(TileSize != std::dynamic_extent)
+  constexpr decltype(auto) tiles() {
+    return make_tiles<TileSize>(crtp_cast(), TileSize);
+  }
+  template <std::size_t TileSize>
+    requires(TileSize != std::dynamic_extent)
+  constexpr decltype(auto) tiles() const {
+    return make_tiles<TileSize>(crtp_cast(), TileSize);
+  }
+
+  /*
+   * Range of all square tiles of the matrix of the size passed at runtime,
+   * which must be positive and match the one set in the type if any
+   */
+  template <std::size_t TileSize = std::dynamic_extent>
+  constexpr decltype(auto) tiles(std::size_t tile_size) {
+    return make_tiles<TileSize>(crtp_cast(), tile_size);
+  }
+  template <std::size_t TileSize = std::dynamic_extent>
+  constexpr decltype(auto) tiles(std::size_t tile_size) const {
+    return make_tiles<TileSize>(crtp_cast(), tile_size);
+  }
+
+  /*
+   * Range of all cells of the matrix along the space-filling curve of the tag
+   */
+  template <iterators::curve_random_access_iterator_tag Tag>
+  constexpr decltype(auto) cells(Tag) {
+    return make_cells(crtp_cast(), Tag{});
+  }
+  template <iterators::curve_random_access_iterator_tag Tag>
+  constexpr decltype(auto) cells(Tag) const {
+    return make_cells(crtp_cast(), Tag{});
+  }
+
+ private:
+  constexpr utils::index diagonal_start(std::ptrdiff_t k) const noexcept {
+    return k < 0 ? utils::index{-k, 0} : utils::index{0, k};
+  }
+  constexpr utils::index antidiagonal_start(std::ptrdiff_t k) const noexcept {
+    const auto last_column =
+        static_cast<std::ptrdiff_t>(crtp_cast().columns()) - 1;
+    return {std::max<std::ptrdiff_t>(k - last_column, 0),
+            std::min(k, last_column)};
+  }
+
+  template <typename Matrix, typename Tag>
+  static constexpr decltype(auto) make_range(Matrix& matrix, Tag,
+                                             utils::index index) {
+    auto storage_proxy = matrix.storage();
+    auto result =
+        ranges::tagged_random_access_range<Tag, decltype(storage_proxy), Rows,
+                                           Columns, 1, Index>(
+            Tag{}, index, std::move(storage_proxy), matrix.rows(),
+            matrix.columns());
+    matrix.record(Tag{},
+                  static_cast<std::size_t>(std::ranges::distance(result)));
+    return result;
+  }
+
+  template <typename Matrix, typename Tag>
+  static constexpr decltype(auto) make_stripes(Matrix& matrix, Tag) {
+    auto storage_proxy = matrix.storage();
+    matrix.record(Tag{}, matrix.rows() * matrix.columns());
+    return ranges::stripe_random_access_range<Tag, decltype(storage_proxy),
+                                              Rows, Columns, Index>(
+        Tag{}, std::move(storage_proxy), matrix.rows(), matrix.columns());
+  }
+
+  template <std::size_t TileSize, typename Matrix>
+  static constexpr decltype(auto) make_tiles(Matrix& matrix,
+                                             std::size_t tile_size) {
+    auto storage_proxy = matrix.storage();
+    matrix.record(utils::kTile, matrix.rows() * matrix.columns());
+    return ranges::tile_random_access_range<decltype(storage_proxy), TileSize,
+                                            Rows, Columns>(
+        utils::kTile, std::move(storage_proxy), tile_size, matrix.rows(),
+        matrix.columns());
+  }
+
+  template <typename Matrix, typename Tag>
+  static constexpr decltype(auto) make_cells(Matrix& matrix, Tag) {
+    auto storage_proxy = matrix.storage();
+    matrix.record(Tag{}, matrix.rows() * matrix.columns());
+    return ranges::curve_random_access_range<Tag, decltype(storage_proxy)>(
+        Tag{}, std::move(storage_proxy), matrix.rows(), matrix.columns());
+  }
+};
+
+}  // namespace matrix_views::matrices
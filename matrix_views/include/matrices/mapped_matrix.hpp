@@ -0,0 +1,182 @@
+#pragma once
+
+#include <cassert>
+#include <filesystem>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+#include "matrices/base_matrix.hpp"
+#include "matrices/matrix.hpp"
+#include "ranges/stripe_random_access_range.hpp"
+#include "ranges/tagged_random_access_range.hpp"
+#include "storage/strided_storage_proxy.hpp"
+#include "utils/conditionally_runtime.hpp"
+#include "utils/index.hpp"
+#include "utils/mapped_file.hpp"
+#include "utils/tags.hpp"
+
+namespace matrix_views::matrices {
+
+/*
+ * Dense matrix backed by a memory-mapped binary file that holds the elements
+ * in the given layout and nothing else. Use a const T to map the file
+ * read-only. Optionally stores matrix dimensions in the type
+ *
+ * Hands out the same tagged ranges as matrix, directly over the mapping.
+ * Opening takes O(1) regardless of the file size since pages are loaded on
+ * first access. Taking the stripes of a direction advises the kernel to read
+ * ahead when they are contiguous and not to otherwise
+ */
+template <typename T, std::size_t Rows = std::dynamic_extent,
+          std::size_t Columns = std::dynamic_extent,
+          matrix_layout_tag Layout = utils::kRowMajorTag>
+  requires std::is_trivially_copyable_v<T>
+class mapped_matrix final
+    : public base_matrix<mapped_matrix<T, Rows, Columns, Layout>, Rows,
+                         Columns> {
+ private:
+  using base = base_matrix<mapped_matrix, Rows, Columns>;
+
+  static inline const constinit bool kDynamicRows = Rows == std::dynamic_extent;
+  static inline const constinit bool kDynamicColumns =
+      Columns == std::dynamic_extent;
+
+  static inline const constinit bool kRowMajor =
+      std::is_same_v<Layout, utils::kRowMajorTag>;
+
+  static inline const constinit std::size_t kRowStride =
+      kRowMajor ? Columns : 1;
+  static inline const constinit std::size_t kColumnStride =
+      kRowMajor ? 1 : Rows;
+
+ public:
+  using value_type = std::remove_cv_t<T>;
+  using layout = Layout;
+
+  using storage_proxy =
+      storage::strided_storage_proxy<T, kRowStride, kColumnStride>;
+  using const_storage_proxy =
+      storage::strided_storage_proxy<const T, kRowStride, kColumnStride>;
+
+  template <typename Tag>
+  using range =
+      ranges::tagged_random_access_range<Tag, storage_proxy, Rows, Columns>;
+  template <typename Tag>
+  using const_range =
+      ranges::tagged_random_access_range<Tag, const_storage_proxy, Rows,
+                                         Columns>;
+
+  template <typename Tag>
+  using stripe_range =
+      ranges::stripe_random_access_range<Tag, storage_proxy, Rows, Columns>;
+  template <typename Tag>
+  using const_stripe_range =
+      ranges::stripe_random_access_range<Tag, const_storage_proxy, Rows,
+                                         Columns>;
+
+ public:
+  /*
+   * Maps the file at the path. Throws std::system_error if the file cannot
+   * be mapped and std::length_error if it is smaller than the matrix
+   */
+  explicit mapped_matrix(const std::filesystem::path& path)
+    requires(!kDynamicRows && !kDynamicColumns)
+      : mapped_matrix(path, Rows, Columns) {}
+  /*
+   * The dimensions set in the type must match the ones passed. Also throws
+   * std::length_error if the matrix is too large to be addressed
+   */
+  mapped_matrix(const std::filesystem::path& path, std::size_t rows,
+                std::size_t columns)
+      : rows_(utils::runtime_if<kDynamicRows>(rows)),
+        columns_(utils::runtime_if<kDynamicColumns>(columns)),
+        file_(path, !std::is_const_v<T>) {
+    assert(*rows_ == rows && *columns_ == columns);
+    if (columns != 0 &&
+        rows > std::numeric_limits<std::size_t>::max() / sizeof(T) / columns) {
+      throw std::length_error("the matrix mapped from " + path.string() +
+                              " is too large");
+    }
+    if (file_.size() < size() * sizeof(T)) {
+      throw std::length_error(path.string() + " is smaller than the matrix");
+    }
+  }
+
+ public:
+  std::size_t rows() const noexcept { return *rows_; }
+  std::size_t columns() const noexcept { return *columns_; }
+  std::size_t size() const noexcept { return *rows_ * *columns_; }
+
+  T* data() noexcept { return static_cast<T*>(file_.data()); }
+  const T* data() const noexcept { return static_cast<const T*>(file_.data()); }
+
+  T& operator()(utils::index index) noexcept { return data()[offset(index)]; }
+  const T& operator()(utils::index index) const noexcept {
+    return data()[offset(index)];
+  }
+
+  storage_proxy storage() noexcept {
+    return storage_proxy(data(), row_stride(), column_stride());
+  }
+  const_storage_proxy storage() const noexcept {
+    return const_storage_proxy(data(), row_stride(), column_stride());
+  }
+
+  /*
+   * Range of all stripes of the matrix in the direction of the tag. Advises
+   * the kernel of the access pattern of the traversal
+   */
+  template <ranges::tagged_random_access_range_tag Tag>
+  stripe_range<Tag> stripes(Tag) noexcept {
+    advise(Tag{});
+    return base::stripes(Tag{});
+  }
+  template <ranges::tagged_random_access_range_tag Tag>
+  const_stripe_range<Tag> stripes(Tag) const noexcept {
+    advise(Tag{});
+    return base::stripes(Tag{});
+  }
+
+  /*
+   * Hints sequential access for the stripes contiguous in the file and random
+   * access for the others, which disables useless read-ahead
+   */
+  template <ranges::tagged_random_access_range_tag Tag>
+  void advise(Tag) const noexcept {
+    file_.advise(storage_proxy::contiguous(Tag{})
+                     ? utils::mapped_file_advice::kSequential
+                     : utils::mapped_file_advice::kRandom);
+  }
+
+  /*
+   * Writes the modified elements back to the file
+   */
+  void flush() const
+    requires(!std::is_const_v<T>)
+  {
+    file_.flush();
+  }
+
+ private:
+  std::size_t row_stride() const noexcept { return kRowMajor ? *columns_ : 1; }
+  std::size_t column_stride() const noexcept {
+    return kRowMajor ? 1 : *rows_;
+  }
+
+  std::size_t offset(utils::index index) const noexcept {
+    return static_cast<std::size_t>(index.row) * row_stride() +
+           static_cast<std::size_t>(index.column) * column_stride();
+  }
+
+ private:
+  [[no_unique_address]] utils::conditionally_runtime<std::size_t, kDynamicRows,
+                                                     Rows> rows_;
+  [[no_unique_address]] utils::conditionally_runtime<
+      std::size_t, kDynamicColumns, Columns> columns_;
+
+  utils::mapped_file file_;
+};
+
+}  // namespace matrix_views::matrices
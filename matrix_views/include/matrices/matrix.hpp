@@ -0,0 +1,207 @@
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include "matrices/base_matrix.hpp"
+#include "ranges/curve_random_access_range.hpp"
+#include "ranges/stripe_random_access_range.hpp"
+#include "ranges/tagged_random_access_range.hpp"
+#include "ranges/tile_random_access_range.hpp"
+#include "storage/strided_storage_proxy.hpp"
+#include "utils/aligned_allocator.hpp"
+#include "utils/conditionally_runtime.hpp"
+#include "utils/index.hpp"
+#include "utils/tags.hpp"
+
+namespace matrix_views::matrices {
+
+/*
+ * Concept representing the set of valid layout tags for matrix
+ */
+template <typename Layout>
+concept matrix_layout_tag = std::same_as<Layout, utils::kRowMajorTag> ||
+                            std::same_as<Layout, utils::kColumnMajorTag>;
+
+/*
+ * Owning dense matrix stored in one cache line aligned allocation. Optionally
+ * stores matrix dimensions in the type
+ *
+ * Hands out tagged ranges backed by a strided_storage_proxy whose unit stride
+ * is known at compile time, so rows of a row-major matrix and columns of a
+ * column-major matrix are contiguous ranges. Their iterators keep the index in
+ * components of the Index type
+ */
+template <typename T, std::size_t Rows = std::dynamic_extent,
+          std::size_t Columns = std::dynamic_extent,
+          matrix_layout_tag Layout = utils::kRowMajorTag,
+          utils::index_integral Index = utils::default_index_t<Rows, Columns>>
+class matrix final
+    : public base_matrix<matrix<T, Rows, Columns, Layout, Index>, Rows,
+                         Columns, Index> {
+ private:
+  static inline const constinit bool kDynamicRows = Rows == std::dynamic_extent;
+  static inline const constinit bool kDynamicColumns =
+      Columns == std::dynamic_extent;
+
+  static inline const constinit bool kRowMajor =
+      std::is_same_v<Layout, utils::kRowMajorTag>;
+
+  static inline const constinit std::size_t kRowStride =
+      kRowMajor ? Columns : 1;
+  static inline const constinit std::size_t kColumnStride =
+      kRowMajor ? 1 : Rows;
+
+ public:
+  using value_type = T;
+  using layout = Layout;
+  using index_type = Index;
+
+  using storage_proxy =
+      storage::strided_storage_proxy<T, kRowStride, kColumnStride>;
+  using const_storage_proxy =
+      storage::strided_storage_proxy<const T, kRowStride, kColumnStride>;
+
+  template <typename Tag>
+  using range =
+      ranges::tagged_random_access_range<Tag, storage_proxy, Rows, Columns, 1,
+                                         Index>;
+  template <typename Tag>
+  using const_range =
+      ranges::tagged_random_access_range<Tag, const_storage_proxy, Rows,
+                                         Columns, 1, Index>;
+
+  template <typename Tag>
+  using stripe_range =
+      ranges::stripe_random_access_range<Tag, storage_proxy, Rows, Columns,
+                                         Index>;
+  template <typename Tag>
+  using const_stripe_range =
+      ranges::stripe_random_access_range<Tag, const_storage_proxy, Rows,
+                                         Columns, Index>;
+
+  template <std::size_t TileSize>
+  using tile_range =
+      ranges::tile_random_access_range<storage_proxy, TileSize, Rows, Columns>;
+  template <std::size_t TileSize>
+  using const_tile_range =
+      ranges::tile_random_access_range<const_storage_proxy, TileSize, Rows,
+                                       Columns>;
+
+  template <typename Tag>
+  using curve_range = ranges::curve_random_access_range<Tag, storage_proxy>;
+  template <typename Tag>
+  using const_curve_range =
+      ranges::curve_random_access_range<Tag, const_storage_proxy>;
+
+ public:
+  constexpr matrix()
+      : rows_(utils::runtime_if<kDynamicRows>(std::size_t())),
+        columns_(utils::runtime_if<kDynamicColumns>(std::size_t())),
+        data_(*rows_ * *columns_) {}
+  constexpr matrix(std::size_t rows, std::size_t columns, const T& value = T())
+      : rows_(utils::runtime_if<kDynamicRows>(rows)),
+        columns_(utils::runtime_if<kDynamicColumns>(columns)),
+        data_(*rows_ * *columns_, value) {}
+
+ public:
+  constexpr std::size_t rows() const noexcept { return *rows_; }
+  constexpr std::size_t columns() const noexcept { return *columns_; }
+  constexpr std::size_t size() const noexcept { return data_.size(); }
+
+  constexpr T* data() noexcept { return data_.data(); }
+  constexpr const T* data() const noexcept { return data_.data(); }
+
+  constexpr T& operator()(utils::index index) noexcept {
+    return data_[offset(index)];
+  }
+  constexpr const T& operator()(utils::index index) const noexcept {
+    return data_[offset(index)];
+  }
+
+  constexpr storage_proxy storage() noexcept {
+    return storage_proxy(data(), row_stride(), column_stride());
+  }
+  constexpr const_storage_proxy storage() const noexcept {
+    return const_storage_proxy(data(), row_stride(), column_stride());
+  }
+
+ private:
+  constexpr std::size_t row_stride() const noexcept {
+    return kRowMajor ? *columns_ : 1;
+  }
+  constexpr std::size_t column_stride() const noexcept {
+    return kRowMajor ? 1 : *rows_;
+  }
+
+  constexpr std::size_t offset(utils::index index) const noexcept {
+    return static_cast<std::size_t>(index.row) * row_stride() +
+           static_cast<std::size_t>(index.column) * column_stride();
+  }
+
+ private:
+  [[no_unique_address]] utils::conditionally_runtime<std::size_t, kDynamicRows,
+                                                     Rows> rows_;
+  [[no_unique_address]] utils::conditionally_runtime<
+      std::size_t, kDynamicColumns, Columns> columns_;
+
+  std::vector<T, utils::aligned_allocator<T>> data_;
+};
+
+/*
+ * Ranges of all rows, columns, diagonals and antidiagonals of a matrix
+ */
+constexpr decltype(auto) rows(auto&& matrix) noexcept
+  requires requires { matrix.stripes(utils::kRow); }
+{
+  return matrix.stripes(utils::kRow);
+}
+
+constexpr decltype(auto) columns(auto&& matrix) noexcept
+  requires requires { matrix.stripes(utils::kColumn); }
+{
+  return matrix.stripes(utils::kColumn);
+}
+
+constexpr decltype(auto) diagonals(auto&& matrix) noexcept
+  requires requires { matrix.stripes(utils::kDiagonal); }
+{
+  return matrix.stripes(utils::kDiagonal);
+}
+
+constexpr decltype(auto) antidiagonals(auto&& matrix) noexcept
+  requires requires { matrix.stripes(utils::kAntidiagonal); }
+{
+  return matrix.stripes(utils::kAntidiagonal);
+}
+
+/*
+ * Range of all square tiles of a matrix, of the size set in the type or
+ * passed at runtime
+ */
+template <std::size_t TileSize>
+  requires(TileSize != std::dynamic_extent)
+constexpr decltype(auto) tiles(auto&& matrix) noexcept
+  requires requires { matrix.template tiles<TileSize>(); }
+{
+  return matrix.template tiles<TileSize>();
+}
+
+template <std::size_t TileSize = std::dynamic_extent>
+constexpr decltype(auto) tiles(auto&& matrix, std::size_t tile_size) noexcept
+  requires requires { matrix.template tiles<TileSize>(tile_size); }
+{
+  return matrix.template tiles<TileSize>(tile_size);
+}
+
+/*
+ * Range of all cells of a matrix along a space-filling curve
+ */
+template <iterators::curve_random_access_iterator_tag Tag>
+constexpr decltype(auto) cells(auto&& matrix, Tag) noexcept
+  requires requires { matrix.cells(Tag{}); }
+{
+  return matrix.cells(Tag{});
+}
+
+}  // namespace matrix_views::matrices
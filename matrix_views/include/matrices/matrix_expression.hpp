@@ -0,0 +1,147 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include "matrices/matrix_view.hpp"
+#include "storage/expression_storage_proxy.hpp"
+
+namespace matrix_views::matrices {
+
+/*
+ * Lazy matrix_view of the function applied to the cells of the matrices at
+ * the same index. The matrices must have the same dimensions, which is
+ * checked at compile time for static extents and asserted otherwise.
+ * Allocates nothing and nested expressions fuse into one function call per
+ * cell
+ */
+template <typename Function, matrix_view_operand Matrix,
+          matrix_view_operand... Matrices>
+constexpr decltype(auto) zip_with(Function function, Matrix&& matrix,
+                                  Matrices&&... matrices) {
+  static_assert(
+      (detail::same_extent(kRowsOf<Matrix>, kRowsOf<Matrices>) && ...) &&
+          (detail::same_extent(kColumnsOf<Matrix>, kColumnsOf<Matrices>) &&
+           ...),
+      "the operands of an expression must have the same dimensions");
+  assert(((matrices.rows() == matrix.rows() &&
+           matrices.columns() == matrix.columns()) &&
+          ...));
+
+  using storage_proxy = storage::expression_storage_proxy<
+      Function, decltype(std::as_const(matrix).storage()),
+      decltype(std::as_const(matrices).storage())...>;
+  return matrix_view<storage_proxy, kRowsOf<Matrix>, kColumnsOf<Matrix>>(
+      storage_proxy(std::move(function), std::as_const(matrix).storage(),
+                    std::as_const(matrices).storage()...),
+      matrix.rows(), matrix.columns());
+}
+
+/*
+ * Lazy matrix of the function applied to every cell of the matrix
+ */
+template <matrix_view_operand Matrix, typename Function>
+constexpr decltype(auto) map(Matrix&& matrix, Function function) {
+  return zip_with(std::move(function), std::forward<Matrix>(matrix));
+}
+
+namespace detail {
+
+template <typename Operation, typename Lhs, typename Rhs>
+constexpr decltype(auto) binary_expression(Operation operation, Lhs&& lhs,
+                                           Rhs&& rhs) {
+  using lhs_t = std::remove_cvref_t<Lhs>;
+  using rhs_t = std::remove_cvref_t<Rhs>;
+  if constexpr (storage::expression_scalar<Lhs>) {
+    return map(std::forward<Rhs>(rhs),
+               storage::scalar_operation<Operation, lhs_t, true>(operation,
+                                                                 lhs));
+  } else if constexpr (storage::expression_scalar<Rhs>) {
+    return map(std::forward<Lhs>(lhs),
+               storage::scalar_operation<Operation, rhs_t, false>(operation,
+                                                                  rhs));
+  } else {
+    return zip_with(operation, std::forward<Lhs>(lhs),
+                    std::forward<Rhs>(rhs));
+  }
+}
+
+}  // namespace detail
+
+/*
+ * Concept representing the operands of a binary expression: two matrices or
+ * a matrix and a scalar broadcast to every cell
+ */
+template <typename Lhs, typename Rhs>
+concept matrix_expression_operands =
+    (matrix_view_operand<Lhs> && matrix_view_operand<Rhs>) ||
+    (matrix_view_operand<Lhs> && storage::expression_scalar<Rhs>) ||
+    (storage::expression_scalar<Lhs> && matrix_view_operand<Rhs>);
+
+/*
+ * Element-wise arithmetic on matrices
+ */
+template <typename Lhs, typename Rhs>
+  requires matrix_expression_operands<Lhs, Rhs>
+constexpr decltype(auto) operator+(Lhs&& lhs, Rhs&& rhs) {
+  return detail::binary_expression(std::plus<>(), std::forward<Lhs>(lhs),
+                                   std::forward<Rhs>(rhs));
+}
+
+template <typename Lhs, typename Rhs>
+  requires matrix_expression_operands<Lhs, Rhs>
+constexpr decltype(auto) operator-(Lhs&& lhs, Rhs&& rhs) {
+  return detail::binary_expression(std::minus<>(), std::forward<Lhs>(lhs),
+                                   std::forward<Rhs>(rhs));
+}
+
+template <typename Lhs, typename Rhs>
+  requires matrix_expression_operands<Lhs, Rhs>
+constexpr decltype(auto) operator*(Lhs&& lhs, Rhs&& rhs) {
+  return detail::binary_expression(std::multiplies<>(), std::forward<Lhs>(lhs),
+                                   std::forward<Rhs>(rhs));
+}
+
+template <typename Lhs, typename Rhs>
+  requires matrix_expression_operands<Lhs, Rhs>
+constexpr decltype(auto) operator/(Lhs&& lhs, Rhs&& rhs) {
+  return detail::binary_expression(std::divides<>(), std::forward<Lhs>(lhs),
+                                   std::forward<Rhs>(rhs));
+}
+
+template <matrix_view_operand Matrix>
+constexpr decltype(auto) operator-(Matrix&& matrix) {
+  return map(std::forward<Matrix>(matrix), std::negate<>());
+}
+
+/*
+ * Evaluates a matrix, e.g. an expression, into another one of the same
+ * dimensions row by row. The destination may be an operand of an element-wise
+ * expression, since every cell is read only to compute itself, but must not
+ * be viewed by the source through adaptors that move cells, e.g. transpose
+ */
+template <typename Destination, matrix_view_operand Source>
+constexpr void assign(Destination& destination, Source&& source)
+  requires requires(std::ptrdiff_t i) {
+    std::ranges::copy(source.row(i), destination.row(i).begin());
+  }
+{
+  if constexpr (matrix_view_operand<Destination&>) {
+    static_assert(
+        detail::same_extent(kRowsOf<Destination&>, kRowsOf<Source>) &&
+            detail::same_extent(kColumnsOf<Destination&>, kColumnsOf<Source>),
+        "the destination must have the dimensions of the source");
+  }
+  assert(destination.rows() == source.rows() &&
+         destination.columns() == source.columns());
+
+  for (std::ptrdiff_t i = 0; i < static_cast<std::ptrdiff_t>(source.rows());
+       ++i) {
+    std::ranges::copy(source.row(i), destination.row(i).begin());
+  }
+}
+
+}  // namespace matrix_views::matrices
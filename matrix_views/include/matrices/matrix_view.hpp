@@ -0,0 +1,232 @@
+#pragma once
+
+#include <cassert>
+#include <concepts>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "matrices/base_matrix.hpp"
+#include "matrices/matrix.hpp"
+#include "ranges/curve_random_access_range.hpp"
+#include "ranges/stripe_random_access_range.hpp"
+#include "ranges/tagged_random_access_range.hpp"
+#include "ranges/tile_random_access_range.hpp"
+#include "storage/shifted_storage_proxy.hpp"
+#include "storage/transposed_storage_proxy.hpp"
+#include "utils/conditionally_runtime.hpp"
+#include "utils/index.hpp"
+#include "utils/tags.hpp"
+
+namespace matrix_views::matrices {
+
+/*
+ * Non-owning matrix over a storage proxy, e.g. a part of another matrix or a
+ * lazy expression. Optionally stores matrix dimensions in the type. Hands out
+ * the same tagged ranges as matrix, with index components of the Index type
+ */
+template <ranges::tagged_random_access_range_storage_proxy StorageProxy,
+          std::size_t Rows = std::dynamic_extent,
+          std::size_t Columns = std::dynamic_extent,
+          utils::index_integral Index = utils::default_index_t<Rows, Columns>>
+class matrix_view final
+    : public base_matrix<matrix_view<StorageProxy, Rows, Columns, Index>, Rows,
+                         Columns, Index> {
+ private:
+  static inline const constinit bool kDynamicRows = Rows == std::dynamic_extent;
+  static inline const constinit bool kDynamicColumns =
+      Columns == std::dynamic_extent;
+
+ public:
+  using value_type = typename StorageProxy::value_type;
+  using storage_proxy = StorageProxy;
+  using index_type = Index;
+
+  template <typename Tag>
+  using range =
+      ranges::tagged_random_access_range<Tag, storage_proxy, Rows, Columns, 1,
+                                         Index>;
+  template <typename Tag>
+  using stripe_range =
+      ranges::stripe_random_access_range<Tag, storage_proxy, Rows, Columns,
+                                         Index>;
+  template <std::size_t TileSize>
+  using tile_range =
+      ranges::tile_random_access_range<storage_proxy, TileSize, Rows, Columns>;
+  template <typename Tag>
+  using curve_range = ranges::curve_random_access_range<Tag, storage_proxy>;
+
+ public:
+  constexpr matrix_view() = default;
+  constexpr explicit matrix_view(StorageProxy storage_proxy)
+    requires(!kDynamicRows && !kDynamicColumns)
+      : storage_proxy_(std::move(storage_proxy)) {}
+  /*
+   * The dimensions set in the type must match the ones passed
+   */
+  constexpr matrix_view(StorageProxy storage_proxy, std::size_t rows,
+                        std::size_t columns)
+      : storage_proxy_(std::move(storage_proxy)),
+        rows_(utils::runtime_if<kDynamicRows>(rows)),
+        columns_(utils::runtime_if<kDynamicColumns>(columns)) {
+    assert(*rows_ == rows && *columns_ == columns);
+  }
+
+ public:
+  constexpr std::size_t rows() const noexcept { return *rows_; }
+  constexpr std::size_t columns() const noexcept { return *columns_; }
+
+  constexpr decltype(auto) operator()(utils::index index) const {
+    return storage_proxy_(index);
+  }
+
+  constexpr storage_proxy storage() const { return storage_proxy_; }
+
+ private:
+  StorageProxy storage_proxy_;
+
+  [[no_unique_address]] utils::conditionally_runtime<std::size_t, kDynamicRows,
+                                                     Rows> rows_ =
+      utils::runtime_if<kDynamicRows>(std::size_t());
+  [[no_unique_address]] utils::conditionally_runtime<
+      std::size_t, kDynamicColumns, Columns> columns_ =
+      utils::runtime_if<kDynamicColumns>(std::size_t());
+};
+
+namespace detail {
+
+template <typename Matrix>
+struct is_matrix_view : std::false_type {};
+
+template <typename StorageProxy, std::size_t Rows, std::size_t Columns,
+          typename Index>
+struct is_matrix_view<matrix_view<StorageProxy, Rows, Columns, Index>>
+    : std::true_type {};
+
+/*
+ * Dimensions that a matrix stores in its type, taken from the type of its
+ * rows
+ */
+template <typename Range>
+struct extents final {
+  static inline const constinit std::size_t kRows = std::dynamic_extent;
+  static inline const constinit std::size_t kColumns = std::dynamic_extent;
+};
+
+template <typename Tag, typename StorageProxy, std::size_t Rows,
+          std::size_t Columns, std::size_t Step, typename Index>
+struct extents<ranges::tagged_random_access_range<Tag, StorageProxy, Rows,
+                                                  Columns, Step, Index>>
+    final {
+  static inline const constinit std::size_t kRows = Rows;
+  static inline const constinit std::size_t kColumns = Columns;
+};
+
+}  // namespace detail
+
+/*
+ * Concept representing a matrix that views, expressions and adaptors can be
+ * built over. Owning matrices are taken by reference, so temporaries are
+ * rejected unless they are views themselves
+ */
+template <typename Matrix>
+concept matrix_view_operand =
+    requires(const std::remove_cvref_t<Matrix>& matrix) {
+      { matrix.rows() } -> std::convertible_to<std::size_t>;
+      { matrix.columns() } -> std::convertible_to<std::size_t>;
+      {
+        matrix.storage()
+      } -> ranges::tagged_random_access_range_storage_proxy;
+    } &&
+    (std::is_lvalue_reference_v<Matrix> ||
+     detail::is_matrix_view<std::remove_cvref_t<Matrix>>::value);
+
+namespace detail {
+
+template <typename Matrix>
+using row_range_t =
+    decltype(std::declval<const std::remove_cvref_t<Matrix>&>().row(0));
+
+}  // namespace detail
+
+/*
+ * Dimensions that a matrix view operand stores in its type, if any
+ */
+template <matrix_view_operand Matrix>
+inline constexpr std::size_t kRowsOf =
+    detail::extents<detail::row_range_t<Matrix>>::kRows;
+template <matrix_view_operand Matrix>
+inline constexpr std::size_t kColumnsOf =
+    detail::extents<detail::row_range_t<Matrix>>::kColumns;
+
+/*
+ * Transposed view of a matrix, writable if the matrix is. The transposition
+ * is folded into the storage proxy, so the rows of the view are the columns
+ * of the matrix with the same cost of access and diagonals mirror over the
+ * main diagonal
+ */
+template <matrix_view_operand Matrix>
+constexpr decltype(auto) transpose(Matrix&& matrix) {
+  auto storage_proxy = storage::transposed(matrix.storage());
+  return matrix_view<decltype(storage_proxy), kColumnsOf<Matrix>,
+                     kRowsOf<Matrix>>(std::move(storage_proxy),
+                                      matrix.columns(), matrix.rows());
+}
+
+namespace detail {
+
+/*
+ * Whether the part of a matrix of the extent in the type fits into the
+ * matrix with the extent in its type, as far as known at compile time
+ */
+constexpr bool fits(std::size_t extent, std::size_t matrix_extent) noexcept {
+  return extent == std::dynamic_extent ||
+         matrix_extent == std::dynamic_extent || extent <= matrix_extent;
+}
+
+/*
+ * Whether two extents may describe the same dimension, i.e. are equal unless
+ * one of them is only known at runtime
+ */
+constexpr bool same_extent(std::size_t lhs, std::size_t rhs) noexcept {
+  return lhs == std::dynamic_extent || rhs == std::dynamic_extent ||
+         lhs == rhs;
+}
+
+}  // namespace detail
+
+/*
+ * View of the rows x columns part of a matrix starting at the index, writable
+ * if the matrix is. The dimensions are passed at runtime and must match the
+ * ones set in the type if any. The part must lie within the matrix. The shift
+ * is folded into the storage proxy, so accessing the view costs the same as
+ * accessing the matrix
+ */
+template <std::size_t Rows = std::dynamic_extent,
+          std::size_t Columns = std::dynamic_extent,
+          matrix_view_operand Matrix>
+constexpr decltype(auto) submatrix(Matrix&& matrix, utils::index index,
+                                   std::size_t rows, std::size_t columns) {
+  static_assert(detail::fits(Rows, kRowsOf<Matrix>) &&
+                    detail::fits(Columns, kColumnsOf<Matrix>),
+                "a submatrix must fit into its matrix");
+  assert(index.row >= 0 && index.column >= 0 &&
+         static_cast<std::size_t>(index.row) + rows <= matrix.rows() &&
+         static_cast<std::size_t>(index.column) + columns <= matrix.columns());
+
+  auto storage_proxy = storage::shifted(matrix.storage(), index);
+  return matrix_view<decltype(storage_proxy), Rows, Columns>(
+      std::move(storage_proxy), rows, columns);
+}
+
+/*
+ * View of the part of a matrix of the dimensions set in the type
+ */
+template <std::size_t Rows, std::size_t Columns, matrix_view_operand Matrix>
+  requires(Rows != std::dynamic_extent && Columns != std::dynamic_extent)
+constexpr decltype(auto) submatrix(Matrix&& matrix, utils::index index) {
+  return submatrix<Rows, Columns>(std::forward<Matrix>(matrix), index, Rows,
+                                  Columns);
+}
+
+}  // namespace matrix_views::matrices
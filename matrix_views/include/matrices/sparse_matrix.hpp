@@ -0,0 +1,127 @@
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include "matrices/matrix.hpp"
+#include "ranges/sparse_random_access_range.hpp"
+#include "ranges/tagged_random_access_range.hpp"
+#include "storage/compressed_storage_proxy.hpp"
+#include "utils/index.hpp"
+#include "utils/tags.hpp"
+
+namespace matrix_views::matrices {
+
+/*
+ * Owning compressed sparse matrix. Row-major layout stores compressed sparse
+ * rows (CSR) and column-major layout compressed sparse columns (CSC)
+ *
+ * Hands out dense tagged ranges over a compressed_storage_proxy for
+ * compatibility and sparse ranges over the nonzeros of the compressed stripes
+ */
+template <typename T, matrix_layout_tag Layout = utils::kRowMajorTag>
+class sparse_matrix final {
+ private:
+  static inline const constinit bool kRowMajor =
+      std::is_same_v<Layout, utils::kRowMajorTag>;
+
+ public:
+  using value_type = T;
+  using layout = Layout;
+
+  /*
+   * Direction of the compressed stripes
+   */
+  using major_tag =
+      std::conditional_t<kRowMajor, utils::kRowTag, utils::kColumnTag>;
+
+  using storage_proxy = storage::compressed_storage_proxy<T, Layout>;
+
+  template <typename Tag>
+  using range = ranges::tagged_random_access_range<Tag, storage_proxy>;
+  using sparse_range =
+      ranges::sparse_random_access_range<major_tag, storage_proxy>;
+
+ public:
+  sparse_matrix() : offsets_(1) {}
+
+  /*
+   * Takes the compressed arrays as is. offsets has one element more than
+   * there are major stripes and the indices of every stripe are sorted
+   */
+  sparse_matrix(std::size_t rows, std::size_t columns,
+                std::vector<std::ptrdiff_t> offsets,
+                std::vector<std::ptrdiff_t> indices, std::vector<T> values)
+      : rows_(rows),
+        columns_(columns),
+        offsets_(std::move(offsets)),
+        indices_(std::move(indices)),
+        values_(std::move(values)) {}
+
+  /*
+   * Compresses the nonzeros of a dense matrix
+   */
+  template <std::size_t Rows, std::size_t Columns, typename DenseLayout,
+            typename Index>
+  explicit sparse_matrix(
+      const matrix<T, Rows, Columns, DenseLayout, Index>& dense)
+      : rows_(dense.rows()), columns_(dense.columns()) {
+    const auto majors =
+        static_cast<std::ptrdiff_t>(kRowMajor ? rows_ : columns_);
+    const auto minors =
+        static_cast<std::ptrdiff_t>(kRowMajor ? columns_ : rows_);
+
+    offsets_.reserve(static_cast<std::size_t>(majors) + 1);
+    offsets_.push_back(0);
+    for (std::ptrdiff_t i = 0; i < majors; ++i) {
+      for (std::ptrdiff_t j = 0; j < minors; ++j) {
+        const auto& value =
+            dense(kRowMajor ? utils::index{i, j} : utils::index{j, i});
+        if (value != T()) {
+          indices_.push_back(j);
+          values_.push_back(value);
+        }
+      }
+      offsets_.push_back(std::ssize(indices_));
+    }
+  }
+
+ public:
+  std::size_t rows() const noexcept { return rows_; }
+  std::size_t columns() const noexcept { return columns_; }
+  std::size_t nonzeros_count() const noexcept { return values_.size(); }
+
+  T operator()(utils::index index) const noexcept { return storage()(index); }
+
+  storage_proxy storage() const noexcept {
+    return storage_proxy(offsets_.data(), indices_.data(), values_.data());
+  }
+
+  range<utils::kRowTag> row(std::ptrdiff_t i) const noexcept {
+    return range<utils::kRowTag>(utils::kRow, {i, 0}, storage(), rows_,
+                                 columns_);
+  }
+  range<utils::kColumnTag> column(std::ptrdiff_t j) const noexcept {
+    return range<utils::kColumnTag>(utils::kColumn, {0, j}, storage(), rows_,
+                                    columns_);
+  }
+
+  /*
+   * Nonzeros of the i-th row of a CSR matrix or column of a CSC matrix
+   */
+  sparse_range nonzeros(major_tag, std::ptrdiff_t i) const noexcept {
+    return sparse_range(major_tag{},
+                        kRowMajor ? utils::index{i, 0} : utils::index{0, i},
+                        storage());
+  }
+
+ private:
+  std::size_t rows_ = 0;
+  std::size_t columns_ = 0;
+
+  std::vector<std::ptrdiff_t> offsets_;
+  std::vector<std::ptrdiff_t> indices_;
+  std::vector<T> values_;
+};
+
+}  // namespace matrix_views::matrices
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <system_error>
+#include <vector>
+
+#include "matrices/base_matrix.hpp"
+#include "matrices/matrix.hpp"
+#include "ranges/stripe_random_access_range.hpp"
+#include "ranges/tagged_random_access_range.hpp"
+#include "storage/tile_cache.hpp"
+#include "storage/tiled_storage_proxy.hpp"
+#include "utils/index.hpp"
+#include "utils/tags.hpp"
+
+namespace matrix_views::matrices {
+
+/*
+ * Read-only out-of-core matrix stored tile by tile in a file, see tile_cache
+ * for the file format. Keeps the recently used tiles in memory within a byte
+ * budget, so matrices larger than the memory can be traversed in any
+ * direction
+ *
+ * Hands out tagged ranges over a tiled_storage_proxy. Read errors during a
+ * traversal propagate from dereferencing the iterators
+ */
+template <typename T>
+class tiled_matrix final : public base_matrix<tiled_matrix<T>> {
+ public:
+  using value_type = T;
+
+  using storage_proxy = storage::tiled_storage_proxy<T>;
+
+  template <typename Tag>
+  using range = ranges::tagged_random_access_range<Tag, storage_proxy>;
+  template <typename Tag>
+  using stripe_range = ranges::stripe_random_access_range<Tag, storage_proxy>;
+
+ public:
+  tiled_matrix(const std::filesystem::path& path, std::size_t rows,
+               std::size_t columns, std::size_t tile_size,
+               std::size_t byte_budget)
+      : rows_(rows),
+        columns_(columns),
+        cache_(std::make_unique<storage::tile_cache<T>>(
+            path, rows, columns, tile_size, byte_budget)) {}
+
+  /*
+   * Writes a dense matrix to a file in the tiled format
+   */
+  template <std::size_t Rows, std::size_t Columns, typename Layout,
+            typename Index>
+  static void store(const std::filesystem::path& path,
+                    const matrix<T, Rows, Columns, Layout, Index>& dense,
+                    std::size_t tile_size) {
+    auto file = std::ofstream(path, std::ios::binary);
+    std::vector<T> tile(tile_size * tile_size);
+
+    const auto size = static_cast<std::ptrdiff_t>(tile_size);
+    const auto rows = static_cast<std::ptrdiff_t>(dense.rows());
+    const auto columns = static_cast<std::ptrdiff_t>(dense.columns());
+    for (std::ptrdiff_t tile_row = 0; tile_row < rows; tile_row += size) {
+      for (std::ptrdiff_t tile_column = 0; tile_column < columns;
+           tile_column += size) {
+        std::fill(tile.begin(), tile.end(), T());
+        for (auto i = tile_row; i < std::min(tile_row + size, rows); ++i) {
+          for (auto j = tile_column; j < std::min(tile_column + size, columns);
+               ++j) {
+            tile[static_cast<std::size_t>((i - tile_row) * size + j -
+                                          tile_column)] = dense({i, j});
+          }
+        }
+        file.write(reinterpret_cast<const char*>(tile.data()),
+                   static_cast<std::streamsize>(tile.size() * sizeof(T)));
+      }
+    }
+
+    if (!file.flush()) {
+      throw std::system_error(std::make_error_code(std::errc::io_error),
+                              path.string());
+    }
+  }
+
+ public:
+  std::size_t rows() const noexcept { return rows_; }
+  std::size_t columns() const noexcept { return columns_; }
+  std::size_t tile_size() const noexcept {
+    return static_cast<std::size_t>(cache_->tile_size());
+  }
+
+  /*
+   * Hit, miss, eviction and prefetch counters of the tile cache
+   */
+  const storage::tile_cache_stats& stats() const noexcept {
+    return cache_->stats();
+  }
+
+  T operator()(utils::index index) const { return storage()(index); }
+
+  storage_proxy storage() const noexcept { return storage_proxy(cache_.get()); }
+
+ private:
+  std::size_t rows_;
+  std::size_t columns_;
+
+  std::unique_ptr<storage::tile_cache<T>> cache_;
+};
+
+}  // namespace matrix_views::matrices
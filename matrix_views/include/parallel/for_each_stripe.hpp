@@ -0,0 +1,114 @@
+#pragma once
+
+#include <algorithm>
+#include <iterator>
+#include <ranges>
+#include <vector>
+
+#include "parallel/thread_pool.hpp"
+
+namespace matrix_views::parallel {
+
+/*
+ * Concept representing a random access range of random access ranges, e.g. a
+ * stripe_random_access_range
+ */
+template <typename Stripes>
+concept stripes_range =
+    std::ranges::random_access_range<Stripes> &&
+    std::ranges::sized_range<Stripes> &&
+    std::ranges::random_access_range<std::ranges::range_reference_t<Stripes>> &&
+    std::ranges::sized_range<std::ranges::range_reference_t<Stripes>>;
+
+namespace detail {
+
+/*
+ * Number of chunks per thread. More chunks balance the load better when the
+ * cost of an element varies at the price of more steals
+ */
+inline constexpr std::ptrdiff_t kChunksPerThread = 8;
+
+/*
+ * Elements of a chunk below which splitting does not pay for the scheduling
+ */
+inline constexpr std::ptrdiff_t kMinChunkSize = 4096;
+
+}  // namespace detail
+
+/*
+ * Calls function(subrange) for pieces of every stripe so that every element
+ * is visited exactly once. The elements of all stripes are split into chunks
+ * of the same size, so short stripes are grouped together and long stripes
+ * are cut into std::ranges::subrange pieces handled by different threads
+ *
+ * Calls for different pieces may run concurrently. The chunk size is derived
+ * from the total number of elements and the size of the pool unless set
+ */
+template <stripes_range Stripes, typename Function>
+void parallel_for_each_stripe(thread_pool& pool, Stripes&& stripes,
+                              const Function& function,
+                              std::ptrdiff_t chunk_size = 0) {
+  const auto count = std::ranges::ssize(stripes);
+  const auto first = std::ranges::begin(stripes);
+
+  // offsets[i] is the number of elements in the stripes before the i-th one
+  std::vector<std::ptrdiff_t> offsets(static_cast<std::size_t>(count) + 1);
+  for (std::ptrdiff_t i = 0; i < count; ++i) {
+    offsets[i + 1] = offsets[i] + std::ranges::ssize(first[i]);
+  }
+
+  const auto size = offsets.back();
+  if (chunk_size <= 0) {
+    const auto chunks =
+        static_cast<std::ptrdiff_t>(pool.size()) * detail::kChunksPerThread;
+    chunk_size = std::max((size + chunks - 1) / chunks, detail::kMinChunkSize);
+  }
+
+  pool.for_each_index((size + chunk_size - 1) / chunk_size,
+                      [&](std::ptrdiff_t chunk) {
+                        const auto begin = chunk * chunk_size;
+                        const auto end = std::min(begin + chunk_size, size);
+
+                        auto i = std::ranges::upper_bound(offsets, begin) -
+                                 offsets.begin() - 1;
+                        for (; offsets[i] < end; ++i) {
+                          const auto stripe = first[i];
+                          const auto stripe_begin = std::ranges::begin(stripe);
+                          function(std::ranges::subrange(
+                              stripe_begin +
+                                  (std::max(begin, offsets[i]) - offsets[i]),
+                              stripe_begin +
+                                  (std::min(end, offsets[i + 1]) - offsets[i])));
+                        }
+                      });
+}
+
+template <stripes_range Stripes, typename Function>
+void parallel_for_each_stripe(Stripes&& stripes, const Function& function) {
+  parallel_for_each_stripe(default_thread_pool(),
+                           std::forward<Stripes>(stripes), function);
+}
+
+/*
+ * Same over all stripes of a matrix in the direction of the tag
+ */
+template <typename Matrix, typename Tag, typename Function>
+  requires requires(Matrix&& matrix, Tag tag) {
+    { matrix.stripes(tag) } -> stripes_range;
+  }
+void parallel_for_each_stripe(thread_pool& pool, Matrix&& matrix, Tag tag,
+                              const Function& function) {
+  parallel_for_each_stripe(pool, matrix.stripes(tag), function);
+}
+
+template <typename Matrix, typename Tag, typename Function>
+  requires requires(Matrix&& matrix, Tag tag) {
+    { matrix.stripes(tag) } -> stripes_range;
+  }
+void parallel_for_each_stripe(Matrix&& matrix, Tag tag,
+                              const Function& function) {
+  parallel_for_each_stripe(default_thread_pool(), matrix.stripes(tag),
+                           function);
+}
+
+}  // namespace matrix_views::parallel
@@ -0,0 +1,233 @@
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace matrix_views::parallel {
+
+/*
+ * Fixed-size pool of threads that runs fork-join loops over index ranges. The
+ * calling thread takes part in every loop, so a pool of size 1 starts no
+ * threads at all
+ *
+ * Every thread owns a contiguous slice of the indices and takes them one by
+ * one from the front. A thread that runs out of work steals the back half of
+ * the largest remaining slice of another thread
+ */
+class thread_pool final {
+ private:
+  /*
+   * Indices not yet taken by the owner of the slice or stolen from it
+   */
+  struct alignas(64) slice final {
+    std::mutex mutex;
+    std::ptrdiff_t begin = 0;
+    std::ptrdiff_t end = 0;
+  };
+
+  /*
+   * Type-erased reference to the body of the running loop
+   */
+  struct job final {
+    void (*invoke)(const void* function, std::ptrdiff_t index);
+    const void* function;
+  };
+
+ public:
+  explicit thread_pool(std::size_t size = std::max<std::size_t>(
+                           std::thread::hardware_concurrency(), 1))
+      : slices_(std::max<std::size_t>(size, 1)) {
+    threads_.reserve(slices_.size() - 1);
+    for (std::size_t i = 1; i < slices_.size(); ++i) {
+      threads_.emplace_back([this, i] { work(i); });
+    }
+  }
+
+  thread_pool(const thread_pool&) = delete;
+  thread_pool& operator=(const thread_pool&) = delete;
+
+  ~thread_pool() {
+    {
+      const std::lock_guard lock(mutex_);
+      stopped_ = true;
+    }
+    started_.notify_all();
+    for (auto& thread : threads_) {
+      thread.join();
+    }
+  }
+
+ public:
+  std::size_t size() const noexcept { return slices_.size(); }
+
+  /*
+   * Calls function(i) for every i in [0, count) and returns when all calls
+   * are done. Rethrows the first exception thrown by the function. Loops
+   * started from different threads run one after another, so the function
+   * must not start a loop on the same pool
+   */
+  template <typename Function>
+  void for_each_index(std::ptrdiff_t count, const Function& function) {
+    if (count <= 0) {
+      return;
+    }
+    if (slices_.size() == 1 || count == 1) {
+      for (std::ptrdiff_t i = 0; i < count; ++i) {
+        function(i);
+      }
+      return;
+    }
+
+    const std::lock_guard loop_lock(loop_mutex_);
+    const auto size = static_cast<std::ptrdiff_t>(slices_.size());
+    for (std::ptrdiff_t i = 0; i < size; ++i) {
+      const std::lock_guard lock(slices_[i].mutex);
+      slices_[i].begin = count * i / size;
+      slices_[i].end = count * (i + 1) / size;
+    }
+
+    {
+      const std::lock_guard lock(mutex_);
+      job_ = {[](const void* function, std::ptrdiff_t index) {
+                (*static_cast<const Function*>(function))(index);
+              },
+              std::addressof(function)};
+      exception_ = nullptr;
+      running_ = threads_.size();
+      ++generation_;
+    }
+    started_.notify_all();
+
+    run(0, job_);
+
+    std::unique_lock lock(mutex_);
+    finished_.wait(lock, [this] { return running_ == 0; });
+    if (exception_) {
+      std::rethrow_exception(std::exchange(exception_, nullptr));
+    }
+  }
+
+ private:
+  void work(std::size_t thread) {
+    std::size_t generation = 0;
+    while (true) {
+      job job;
+      {
+        std::unique_lock lock(mutex_);
+        started_.wait(lock,
+                      [&] { return stopped_ || generation_ != generation; });
+        if (stopped_) {
+          return;
+        }
+        generation = generation_;
+        job = job_;
+      }
+
+      run(thread, job);
+
+      {
+        const std::lock_guard lock(mutex_);
+        --running_;
+      }
+      finished_.notify_one();
+    }
+  }
+
+  void run(std::size_t thread, job job) noexcept {
+    try {
+      for (std::ptrdiff_t index; (index = take(thread)) >= 0 ||
+                                 (index = steal(thread)) >= 0;) {
+        job.invoke(job.function, index);
+      }
+    } catch (...) {
+      const std::lock_guard lock(mutex_);
+      if (!exception_) {
+        exception_ = std::current_exception();
+      }
+      // Drain the remaining indices so that other threads stop early
+      for (auto& slice : slices_) {
+        const std::lock_guard slice_lock(slice.mutex);
+        slice.begin = slice.end;
+      }
+    }
+  }
+
+  /*
+   * Takes the next index of the own slice, or returns -1
+   */
+  std::ptrdiff_t take(std::size_t thread) noexcept {
+    auto& slice = slices_[thread];
+    const std::lock_guard lock(slice.mutex);
+    return slice.begin < slice.end ? slice.begin++ : -1;
+  }
+
+  /*
+   * Moves the back half of the largest other slice to the own slice and takes
+   * its first index, or returns -1 when no work is left
+   */
+  std::ptrdiff_t steal(std::size_t thread) noexcept {
+    while (true) {
+      std::size_t victim = thread;
+      std::ptrdiff_t largest = 0;
+      for (std::size_t i = 0; i < slices_.size(); ++i) {
+        const std::lock_guard lock(slices_[i].mutex);
+        if (slices_[i].end - slices_[i].begin > largest) {
+          largest = slices_[i].end - slices_[i].begin;
+          victim = i;
+        }
+      }
+      if (victim == thread) {
+        return -1;
+      }
+
+      std::ptrdiff_t begin = 0, end = 0;
+      {
+        auto& slice = slices_[victim];
+        const std::lock_guard lock(slice.mutex);
+        if (slice.begin == slice.end) {
+          continue;
+        }
+        begin = slice.begin + (slice.end - slice.begin) / 2;
+        end = std::exchange(slice.end, begin);
+      }
+
+      auto& slice = slices_[thread];
+      const std::lock_guard lock(slice.mutex);
+      slice.begin = begin + 1;
+      slice.end = end;
+      return begin;
+    }
+  }
+
+ private:
+  std::vector<slice> slices_;
+  std::vector<std::thread> threads_;
+
+  std::mutex loop_mutex_;
+
+  std::mutex mutex_;
+  std::condition_variable started_;
+  std::condition_variable finished_;
+  job job_ = {};
+  std::exception_ptr exception_;
+  std::size_t running_ = 0;
+  std::size_t generation_ = 0;
+  bool stopped_ = false;
+};
+
+/*
+ * Process-wide pool with a thread per hardware thread
+ */
+inline thread_pool& default_thread_pool() {
+  static thread_pool pool;
+  return pool;
+}
+
+}  // namespace matrix_views::parallel
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "kernels/transpose.hpp"
+#include "parallel/thread_pool.hpp"
+
+namespace matrix_views::parallel {
+
+namespace detail {
+
+/*
+ * Bands of source rows per thread, and the fewest rows of a band. Bands are
+ * whole numbers of micro-kernels, so that no band ends mid-block
+ */
+inline constexpr std::ptrdiff_t kBandsPerThread = 4;
+inline constexpr std::ptrdiff_t kMinBandRows = 64;
+
+}  // namespace detail
+
+/*
+ * Same as kernels::transpose with the rows of the source split into bands
+ * that threads of the pool transpose concurrently. Every band writes to its
+ * own columns of the destination
+ */
+template <kernels::transpose_matrix Source,
+          kernels::transpose_matrix Destination>
+void parallel_transpose(thread_pool& pool, const Source& source,
+                        Destination&& destination) {
+  static_assert(
+      kernels::detail::transposed_extents<Source,
+                                          std::remove_cvref_t<Destination>>(),
+      "the destination must have the dimensions of the transposed source");
+  assert(destination.rows() == source.columns() &&
+         destination.columns() == source.rows());
+
+  const auto rows = static_cast<std::ptrdiff_t>(source.rows());
+  const auto columns = static_cast<std::ptrdiff_t>(source.columns());
+  const auto bands =
+      static_cast<std::ptrdiff_t>(pool.size()) * detail::kBandsPerThread;
+  const auto band_rows =
+      std::max((rows + bands - 1) / bands / kernels::detail::kMicroKernel *
+                   kernels::detail::kMicroKernel,
+               detail::kMinBandRows);
+
+  const auto source_storage = source.storage();
+  const auto destination_storage = destination.storage();
+  pool.for_each_index((rows + band_rows - 1) / band_rows,
+                      [&](std::ptrdiff_t band) {
+                        const auto first = band * band_rows;
+                        kernels::detail::transpose_rows(
+                            source_storage, destination_storage, columns,
+                            first, std::min(first + band_rows, rows));
+                      });
+}
+
+template <kernels::transpose_matrix Source,
+          kernels::transpose_matrix Destination>
+void parallel_transpose(const Source& source, Destination&& destination) {
+  parallel_transpose(default_thread_pool(), source,
+                     std::forward<Destination>(destination));
+}
+
+}  // namespace matrix_views::parallel
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+
+#include "parallel/thread_pool.hpp"
+#include "utils/index.hpp"
+
+namespace matrix_views::parallel {
+
+namespace detail {
+
+/*
+ * Cells of an antidiagonal below which splitting it across threads does not
+ * pay for the scheduling
+ */
+inline constexpr std::ptrdiff_t kMinWavefrontChunkSize = 256;
+
+/*
+ * Calls update(index) for every cell of the k-th antidiagonal of a rows x
+ * columns grid, i.e. the cells with row + column == k, split across threads
+ */
+template <typename Function>
+void antidiagonal_wavefront(thread_pool& pool, std::ptrdiff_t rows,
+                            std::ptrdiff_t columns, std::ptrdiff_t k,
+                            const Function& update) {
+  const auto first_row = std::max<std::ptrdiff_t>(k - (columns - 1), 0);
+  const auto size = std::min(rows - 1, k) - first_row + 1;
+
+  const auto chunks = static_cast<std::ptrdiff_t>(pool.size());
+  const auto chunk_size =
+      std::max((size + chunks - 1) / chunks, kMinWavefrontChunkSize);
+  pool.for_each_index((size + chunk_size - 1) / chunk_size,
+                      [&](std::ptrdiff_t chunk) {
+                        const auto begin = first_row + chunk * chunk_size;
+                        const auto end =
+                            std::min(begin + chunk_size, first_row + size);
+                        for (auto row = begin; row < end; ++row) {
+                          update(utils::index{row, k - row});
+                        }
+                      });
+}
+
+}  // namespace detail
+
+/*
+ * Calls update(index) for every cell of a rows x columns grid so that a cell
+ * is updated after the cells above, to the left and above to the left of it.
+ * Suits dynamic programming matrices such as edit distance
+ *
+ * Antidiagonals are processed in order and the cells of one antidiagonal run
+ * in parallel. With a tile size, the grid is split into square tiles instead:
+ * tiles of one antidiagonal of tiles run in parallel and cells of a tile are
+ * updated row by row, which takes one synchronization per antidiagonal of
+ * tiles instead of one per antidiagonal of cells
+ */
+template <typename Function>
+void parallel_wavefront(thread_pool& pool, std::size_t rows,
+                        std::size_t columns, const Function& update,
+                        std::size_t tile_size = 0) {
+  if (rows == 0 || columns == 0) {
+    return;
+  }
+
+  if (tile_size == 0) {
+    const auto antidiagonals = static_cast<std::ptrdiff_t>(rows + columns - 1);
+    for (std::ptrdiff_t k = 0; k < antidiagonals; ++k) {
+      detail::antidiagonal_wavefront(pool, static_cast<std::ptrdiff_t>(rows),
+                                     static_cast<std::ptrdiff_t>(columns), k,
+                                     update);
+    }
+    return;
+  }
+
+  const auto size = static_cast<std::ptrdiff_t>(tile_size);
+  const auto tile_rows =
+      static_cast<std::ptrdiff_t>((rows + tile_size - 1) / tile_size);
+  const auto tile_columns =
+      static_cast<std::ptrdiff_t>((columns + tile_size - 1) / tile_size);
+
+  for (std::ptrdiff_t k = 0; k < tile_rows + tile_columns - 1; ++k) {
+    const auto first_tile_row =
+        std::max<std::ptrdiff_t>(k - (tile_columns - 1), 0);
+    const auto tiles = std::min(tile_rows - 1, k) - first_tile_row + 1;
+    pool.for_each_index(tiles, [&](std::ptrdiff_t tile) {
+      const auto tile_row = first_tile_row + tile;
+      const auto tile_column = k - tile_row;
+      const auto row_end = std::min((tile_row + 1) * size,
+                                    static_cast<std::ptrdiff_t>(rows));
+      const auto column_end = std::min((tile_column + 1) * size,
+                                       static_cast<std::ptrdiff_t>(columns));
+      for (auto row = tile_row * size; row < row_end; ++row) {
+        for (auto column = tile_column * size; column < column_end; ++column) {
+          update(utils::index{row, column});
+        }
+      }
+    });
+  }
+}
+
+template <typename Function>
+void parallel_wavefront(std::size_t rows, std::size_t columns,
+                        const Function& update, std::size_t tile_size = 0) {
+  parallel_wavefront(default_thread_pool(), rows, columns, update, tile_size);
+}
+
+}  // namespace matrix_views::parallel
@@ -45,13 +45,21 @@ class base_random_access_range {
     return std::make_reverse_iterator(crtp_cast()->begin());
   }
 
+  /*
+   * Derived ranges that know their size in closed form may implement ssize()
+   * to spare building the iterators
+   */
   constexpr std::size_t size() const noexcept {
-    return static_cast<std::size_t>(this->ssize());
+    return static_cast<std::size_t>(crtp_cast()->ssize());
   }
   constexpr decltype(auto) ssize() const noexcept {
     return std::distance(crtp_cast()->begin(), crtp_cast()->end());
   }
-  constexpr bool empty() const noexcept { return this->size() == 0; }
+  constexpr bool empty() const noexcept { return crtp_cast()->ssize() == 0; }
+
+  constexpr decltype(auto) operator[](std::ptrdiff_t n) const {
+    return crtp_cast()->begin()[n];
+  }
 };
 
 }  // namespace matrix_views::ranges
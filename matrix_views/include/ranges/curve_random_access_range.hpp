@@ -0,0 +1,57 @@
+#pragma once
+
+#include "iterators/curve_random_access_iterator.hpp"
+#include "ranges/base_random_access_range.hpp"
+#include "ranges/tagged_random_access_range.hpp"
+#include "utils/tags.hpp"
+
+namespace matrix_views::ranges {
+
+/*
+ * Range of all cells of a matrix along a space-filling curve. Suits visits of
+ * the whole matrix in any order, since cells adjacent in the order are close
+ * to each other in memory for both row-major and column-major layouts
+ */
+template <iterators::curve_random_access_iterator_tag Tag,
+          tagged_random_access_range_storage_proxy StorageProxy>
+class curve_random_access_range final
+    : public base_random_access_range<
+          curve_random_access_range<Tag, StorageProxy>>,
+      public std::ranges::view_base,
+      public StorageProxy {
+ private:
+  using iterator = iterators::curve_random_access_iterator<Tag, StorageProxy>;
+
+ public:
+  constexpr curve_random_access_range() noexcept = default;
+  constexpr curve_random_access_range(Tag, StorageProxy storage_proxy,
+                                      std::size_t rows,
+                                      std::size_t columns) noexcept
+      : base_random_access_range<curve_random_access_range>(),
+        StorageProxy(std::move(storage_proxy)),
+        rows_(rows),
+        columns_(columns) {}
+
+ public:
+  constexpr iterator begin() const noexcept { return make_iterator(0); }
+
+  constexpr iterator end() const noexcept {
+    return make_iterator(static_cast<std::ptrdiff_t>(rows_ * columns_));
+  }
+
+ private:
+  constexpr iterator make_iterator(std::ptrdiff_t n) const noexcept {
+    return iterator(Tag{}, {n, 0}, static_cast<const StorageProxy&>(*this),
+                    rows_, columns_);
+  }
+
+ private:
+  std::size_t rows_ = 0;
+  std::size_t columns_ = 0;
+};
+
+}  // namespace matrix_views::ranges
+
+template <typename Tag, typename StorageProxy>
+inline constexpr bool std::ranges::enable_borrowed_range<
+    matrix_views::ranges::curve_random_access_range<Tag, StorageProxy>> = true;
@@ -0,0 +1,194 @@
+#pragma once
+
+#include <cassert>
+#include <functional>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "ranges/tagged_random_access_range.hpp"
+#include "storage/expression_storage_proxy.hpp"
+#include "storage/shifted_storage_proxy.hpp"
+#include "utils/index.hpp"
+
+namespace matrix_views::ranges {
+
+namespace detail {
+
+template <typename Range>
+struct tagged_random_access_range_traits final {
+  static inline const constinit bool kTagged = false;
+};
+
+template <typename Tag, typename StorageProxy, std::size_t Rows,
+          std::size_t Columns, std::size_t Step, typename Index>
+struct tagged_random_access_range_traits<
+    tagged_random_access_range<Tag, StorageProxy, Rows, Columns, Step, Index>>
+    final {
+  static inline const constinit bool kTagged = true;
+
+  static inline const constinit std::size_t kStep = Step;
+
+  using tag = Tag;
+  using storage_proxy = StorageProxy;
+
+  template <typename ExpressionStorageProxy>
+  using range = tagged_random_access_range<Tag, ExpressionStorageProxy, Rows,
+                                           Columns, Step, Index>;
+};
+
+template <typename Range>
+using traits = tagged_random_access_range_traits<std::remove_cvref_t<Range>>;
+
+/*
+ * Whether two steps may be equal, i.e. are equal unless one of them is only
+ * known at runtime
+ */
+constexpr bool same_step(std::size_t lhs, std::size_t rhs) noexcept {
+  return lhs == std::dynamic_extent || rhs == std::dynamic_extent ||
+         lhs == rhs;
+}
+
+template <typename Range>
+decltype(auto) storage_proxy(const Range& range) noexcept {
+  return static_cast<const typename traits<Range>::storage_proxy&>(range);
+}
+
+}  // namespace detail
+
+/*
+ * Concept representing a tagged_random_access_range that can be an operand of
+ * an expression
+ */
+template <typename Range>
+concept tagged_random_access_range_operand = detail::traits<Range>::kTagged;
+
+/*
+ * Concept representing tagged_random_access_range operands of one expression,
+ * i.e. with the same direction and the same step where set in the types
+ */
+template <typename Range, typename... Ranges>
+concept tagged_random_access_range_zippable =
+    tagged_random_access_range_operand<Range> &&
+    (tagged_random_access_range_operand<Ranges> && ...) &&
+    (std::same_as<typename detail::traits<Range>::tag,
+                  typename detail::traits<Ranges>::tag> &&
+     ...) &&
+    (detail::same_step(detail::traits<Range>::kStep,
+                       detail::traits<Ranges>::kStep) &&
+     ...);
+
+/*
+ * Lazy range of the function applied to the elements of the ranges at the
+ * same position. The ranges must have the same direction, step and size.
+ * Steps set in the types must be equal, and runtime steps and sizes are
+ * asserted
+ *
+ * The result is a tagged_random_access_range over the matrix of the first
+ * range that evaluates the function on dereference. It allocates nothing and
+ * nested expressions fuse into one function call per element
+ */
+template <typename Function, typename Range, typename... Ranges>
+  requires tagged_random_access_range_zippable<Range, Ranges...>
+constexpr decltype(auto) zip_with(Function function, const Range& range,
+                                  const Ranges&... ranges) {
+  assert(((ranges.step() == range.step() &&
+           std::ranges::size(ranges) == std::ranges::size(range)) &&
+          ...));
+
+  // Every operand is folded onto its first element and accessed at the
+  // distance from the origin of the first range, so that no proxy points
+  // outside of its matrix
+  const auto origin = range.origin();
+  const auto shift = [](const auto& that) {
+    return storage::shifted(detail::storage_proxy(that), that.origin());
+  };
+
+  using expression_storage_proxy =
+      storage::expression_storage_proxy<Function, decltype(shift(range)),
+                                        decltype(shift(ranges))...>;
+  using storage_proxy =
+      storage::shifted_storage_proxy<expression_storage_proxy>;
+  using result =
+      typename detail::traits<Range>::template range<storage_proxy>;
+
+  return result(typename detail::traits<Range>::tag{}, origin,
+                storage_proxy(expression_storage_proxy(std::move(function),
+                                                       shift(range),
+                                                       shift(ranges)...),
+                              {-origin.row, -origin.column}),
+                range.rows(), range.columns(), range.step());
+}
+
+/*
+ * Lazy range of the function applied to every element of the range
+ */
+template <tagged_random_access_range_operand Range, typename Function>
+constexpr decltype(auto) map(const Range& range, Function function) {
+  return zip_with(std::move(function), range);
+}
+
+namespace detail {
+
+template <typename Operation, typename Lhs, typename Rhs>
+constexpr decltype(auto) binary_expression(Operation operation, const Lhs& lhs,
+                                           const Rhs& rhs) {
+  if constexpr (storage::expression_scalar<Lhs>) {
+    return map(rhs,
+               storage::scalar_operation<Operation, Lhs, true>(operation, lhs));
+  } else if constexpr (storage::expression_scalar<Rhs>) {
+    return map(
+        lhs, storage::scalar_operation<Operation, Rhs, false>(operation, rhs));
+  } else {
+    return zip_with(operation, lhs, rhs);
+  }
+}
+
+}  // namespace detail
+
+/*
+ * Concept representing the operands of a binary expression: two ranges or a
+ * range and a scalar broadcast to every element
+ */
+template <typename Lhs, typename Rhs>
+concept tagged_random_access_range_operands =
+    tagged_random_access_range_zippable<Lhs, Rhs> ||
+    (tagged_random_access_range_operand<Lhs> &&
+     storage::expression_scalar<Rhs>) ||
+    (storage::expression_scalar<Lhs> &&
+     tagged_random_access_range_operand<Rhs>);
+
+/*
+ * Element-wise arithmetic on ranges
+ */
+template <typename Lhs, typename Rhs>
+  requires tagged_random_access_range_operands<Lhs, Rhs>
+constexpr decltype(auto) operator+(const Lhs& lhs, const Rhs& rhs) {
+  return detail::binary_expression(std::plus<>(), lhs, rhs);
+}
+
+template <typename Lhs, typename Rhs>
+  requires tagged_random_access_range_operands<Lhs, Rhs>
+constexpr decltype(auto) operator-(const Lhs& lhs, const Rhs& rhs) {
+  return detail::binary_expression(std::minus<>(), lhs, rhs);
+}
+
+template <typename Lhs, typename Rhs>
+  requires tagged_random_access_range_operands<Lhs, Rhs>
+constexpr decltype(auto) operator*(const Lhs& lhs, const Rhs& rhs) {
+  return detail::binary_expression(std::multiplies<>(), lhs, rhs);
+}
+
+template <typename Lhs, typename Rhs>
+  requires tagged_random_access_range_operands<Lhs, Rhs>
+constexpr decltype(auto) operator/(const Lhs& lhs, const Rhs& rhs) {
+  return detail::binary_expression(std::divides<>(), lhs, rhs);
+}
+
+template <tagged_random_access_range_operand Range>
+constexpr decltype(auto) operator-(const Range& range) {
+  return map(range, std::negate<>());
+}
+
+}  // namespace matrix_views::ranges
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "iterators/sparse_random_access_iterator.hpp"
+#include "ranges/base_random_access_range.hpp"
+#include "utils/index.hpp"
+#include "utils/tags.hpp"
+
+namespace matrix_views::ranges {
+
+/*
+ * Range of the stored nonzeros of a row or a column as (index, value) pairs.
+ * Skips the zeros that a tagged_random_access_range over the same storage
+ * proxy yields
+ */
+template <typename Tag, typename StorageProxy>
+  requires(std::same_as<Tag, utils::kRowTag> ||
+           std::same_as<Tag, utils::kColumnTag>) &&
+          iterators::sparse_random_access_iterator_storage_proxy<StorageProxy,
+                                                                 Tag>
+class sparse_random_access_range final
+    : public base_random_access_range<
+          sparse_random_access_range<Tag, StorageProxy>>,
+      public StorageProxy {
+ private:
+  static inline const constinit bool kRowTag =
+      std::is_same_v<Tag, utils::kRowTag>;
+
+  using iterator = iterators::sparse_random_access_iterator<Tag, StorageProxy>;
+
+ public:
+  constexpr sparse_random_access_range() noexcept = default;
+
+  /*
+   * The index is the start of the row or the column as for
+   * tagged_random_access_range
+   */
+  constexpr sparse_random_access_range(Tag, utils::index index,
+                                       StorageProxy storage_proxy) noexcept
+      : base_random_access_range<sparse_random_access_range>(),
+        StorageProxy(std::move(storage_proxy)),
+        major_(kRowTag ? index.row : index.column) {}
+
+ public:
+  constexpr iterator begin() const noexcept {
+    return iterator(Tag{}, {major_, StorageProxy::first(major_)},
+                    static_cast<const StorageProxy&>(*this));
+  }
+
+  constexpr iterator end() const noexcept {
+    return iterator(Tag{}, {major_, StorageProxy::last(major_)},
+                    static_cast<const StorageProxy&>(*this));
+  }
+
+ private:
+  std::ptrdiff_t major_ = 0;
+};
+
+}  // namespace matrix_views::ranges
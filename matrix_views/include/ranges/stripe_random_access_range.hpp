@@ -0,0 +1,92 @@
+#pragma once
+
+#include <span>
+
+#include "iterators/stripe_random_access_iterator.hpp"
+#include "ranges/base_random_access_range.hpp"
+#include "utils/conditionally_runtime.hpp"
+#include "utils/index.hpp"
+#include "utils/tags.hpp"
+
+namespace matrix_views::ranges {
+
+/*
+ * Range of all stripes of a matrix in a set direction. Its elements are
+ * tagged_random_access_range objects sharing one storage proxy. Optionally
+ * stores matrix dimensions in the type
+ *
+ * The stripes hand out iterators with index components of the Index type
+ */
+template <tagged_random_access_range_tag Tag,
+          tagged_random_access_range_storage_proxy StorageProxy,
+          std::size_t Rows = std::dynamic_extent,
+          std::size_t Columns = std::dynamic_extent,
+          utils::index_integral Index = utils::default_index_t<Rows, Columns>>
+class stripe_random_access_range final
+    : public base_random_access_range<stripe_random_access_range<
+          Tag, StorageProxy, Rows, Columns, Index>>,
+      public std::ranges::view_base,
+      public StorageProxy {
+ private:
+  static inline const constinit bool kDynamicRows = Rows == std::dynamic_extent;
+  static inline const constinit bool kDynamicColumns =
+      Columns == std::dynamic_extent;
+
+ private:
+  static inline const constinit bool kRowTag =
+      std::is_same_v<Tag, utils::kRowTag>;
+  static inline const constinit bool kColumnTag =
+      std::is_same_v<Tag, utils::kColumnTag>;
+
+  using iterator =
+      iterators::stripe_random_access_iterator<Tag, StorageProxy, Rows,
+                                               Columns, Index>;
+
+ public:
+  constexpr stripe_random_access_range() noexcept = default;
+  constexpr stripe_random_access_range(
+      Tag, StorageProxy storage_proxy,
+      std::size_t rows = std::dynamic_extent,
+      std::size_t columns = std::dynamic_extent) noexcept
+      : base_random_access_range<stripe_random_access_range>(),
+        StorageProxy(std::move(storage_proxy)),
+        rows_(utils::runtime_if<kDynamicRows>(rows)),
+        columns_(utils::runtime_if<kDynamicColumns>(columns)) {}
+
+ public:
+  constexpr iterator begin() const noexcept {
+    const auto first = std::is_same_v<Tag, utils::kDiagonalTag>
+                           ? 1 - static_cast<std::ptrdiff_t>(*rows_)
+                           : 0;
+    return iterator(Tag{}, {0, first}, static_cast<const StorageProxy&>(*this),
+                    *rows_, *columns_);
+  }
+
+  constexpr iterator end() const noexcept {
+    const auto rows = static_cast<std::ptrdiff_t>(*rows_);
+    const auto columns = static_cast<std::ptrdiff_t>(*columns_);
+    if constexpr (kRowTag) {
+      return begin() + rows;
+    } else if constexpr (kColumnTag) {
+      return begin() + columns;
+    } else {
+      return begin() + (rows && columns ? rows + columns - 1 : 0);
+    }
+  }
+
+ private:
+  [[no_unique_address]] utils::conditionally_runtime<std::size_t, kDynamicRows,
+                                                     Rows> rows_ =
+      utils::runtime_if<kDynamicRows>(std::size_t());
+  [[no_unique_address]] utils::conditionally_runtime<
+      std::size_t, kDynamicColumns, Columns> columns_ =
+      utils::runtime_if<kDynamicColumns>(std::size_t());
+};
+
+}  // namespace matrix_views::ranges
+
+template <typename Tag, typename StorageProxy, std::size_t Rows,
+          std::size_t Columns, typename Index>
+inline constexpr bool std::ranges::enable_borrowed_range<
+    matrix_views::ranges::stripe_random_access_range<Tag, StorageProxy, Rows,
+                                                     Columns, Index>> = true;
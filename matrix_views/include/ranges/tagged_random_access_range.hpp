@@ -1,10 +1,15 @@
 #pragma once
 
+#include <algorithm>
+#include <cassert>
+#include <ranges>
 #include <span>
+#include <utility>
 
 #include "iterators/tagged_random_access_iterator.hpp"
 #include "ranges/base_random_access_range.hpp"
 #include "utils/conditionally_runtime.hpp"
+#include "utils/index.hpp"
 #include "utils/tags.hpp"
 
 namespace matrix_views::ranges {
@@ -25,22 +30,60 @@ template <typename StorageProxy>
 concept tagged_random_access_range_storage_proxy =
     std::invocable<const StorageProxy, utils::index>;
 
+/*
+ * Concept representing a storage proxy whose cells are structurally zero
+ * outside of a band of diagonals, e.g. packed_triangular_storage_proxy
+ */
+template <typename StorageProxy>
+concept tagged_random_access_range_banded_storage_proxy =
+    tagged_random_access_range_storage_proxy<StorageProxy> &&
+    requires(const StorageProxy storage_proxy) {
+      {
+        storage_proxy.band()
+      } -> std::same_as<std::pair<std::ptrdiff_t, std::ptrdiff_t>>;
+    };
+
+/*
+ * Concept representing a storage proxy that reports the runs of elements
+ * adjacent in memory in the direction of the tag, e.g. strided_storage_proxy
+ */
+template <typename StorageProxy, typename Tag>
+concept tagged_random_access_range_segmented_storage_proxy =
+    tagged_random_access_range_storage_proxy<StorageProxy> &&
+    requires(const StorageProxy storage_proxy, utils::index index,
+             std::ptrdiff_t size) {
+      {
+        storage_proxy.segment(Tag{}, index, size)
+      } -> std::ranges::contiguous_range;
+    };
+
 /*
  * Tagged range class with a set direction. Implements begin/end. Optionally
  * stores matrix dimensions in the type
+ *
+ * Takes every Step-th cell in the direction, e.g. see stride(). The step is
+ * either set in the type or passed at runtime
+ *
+ * Stores the index of the first element and hands out iterators with index
+ * components of the Index type. Defaults to 32-bit components if the
+ * dimensions are stored in the type and fit into them
  */
 template <tagged_random_access_range_tag Tag,
           tagged_random_access_range_storage_proxy StorageProxy,
           std::size_t Rows = std::dynamic_extent,
-          std::size_t Columns = std::dynamic_extent>
+          std::size_t Columns = std::dynamic_extent, std::size_t Step = 1,
+          utils::index_integral Index = utils::default_index_t<Rows, Columns>>
 class tagged_random_access_range final
-    : public base_random_access_range<
-          tagged_random_access_range<Tag, StorageProxy, Rows, Columns>>,
+    : public base_random_access_range<tagged_random_access_range<
+          Tag, StorageProxy, Rows, Columns, Step, Index>>,
+      public std::ranges::view_base,
       public StorageProxy {
  private:
   static inline const constinit bool kDynamicRows = Rows == std::dynamic_extent;
   static inline const constinit bool kDynamicColumns =
       Columns == std::dynamic_extent;
+  static inline const constinit bool kDynamicStep = Step == std::dynamic_extent;
+  static_assert(Step != 0, "the step of a range must be positive");
 
  private:
   static inline const constinit bool kRowTag =
@@ -52,46 +95,275 @@ class tagged_random_access_range final
   static inline const constinit bool kAntidiagonalTag =
       std::is_same_v<Tag, utils::kAntidiagonalTag>;
 
+  using iterator =
+      iterators::tagged_random_access_iterator<Tag, StorageProxy, Step, Index>;
+
  public:
   constexpr tagged_random_access_range() noexcept = default;
   constexpr tagged_random_access_range(
       Tag, utils::index index, StorageProxy storage_proxy,
       std::size_t rows = std::dynamic_extent,
-      std::size_t columns = std::dynamic_extent) noexcept
+      std::size_t columns = std::dynamic_extent,
+      std::size_t step = Step) noexcept
       : base_random_access_range<tagged_random_access_range>(),
         StorageProxy(std::move(storage_proxy)),
-        index_(index),
+        index_(static_cast<utils::basic_index<Index>>(index)),
         rows_(utils::runtime_if<kDynamicRows>(rows)),
-        columns_(utils::runtime_if<kDynamicColumns>(columns)) {}
+        columns_(utils::runtime_if<kDynamicColumns>(columns)),
+        step_(utils::runtime_if<kDynamicStep>(std::move(step))) {
+    assert(*step_ != 0);
+    assert(std::in_range<Index>(index.row) &&
+           std::in_range<Index>(index.column));
+  }
 
  public:
-  constexpr decltype(auto) begin() const noexcept {
-    return iterators::tagged_random_access_iterator(
-        Tag{}, index_, static_cast<StorageProxy>(*this));
+  constexpr iterator begin() const noexcept {
+    return iterator(Tag{}, origin(), static_cast<StorageProxy>(*this), *step_);
+  }
+
+  /*
+   * Built directly at the index past the last element, so that no iterator
+   * is advanced to get there
+   */
+  constexpr iterator end() const noexcept {
+    return iterator(Tag{}, end_index(), static_cast<StorageProxy>(*this),
+                    *step_);
+  }
+
+  /*
+   * Lightweight end of the range that holds the position of end() only.
+   * Loops comparing an iterator against it check one index component, and
+   * std::ranges::subrange(begin(), sentinel()) is a sized view
+   */
+  constexpr iterators::tagged_random_access_sentinel<Tag> sentinel()
+      const noexcept {
+    if constexpr (kRowTag) {
+      return iterators::tagged_random_access_sentinel<Tag>(end_index().column);
+    } else {
+      return iterators::tagged_random_access_sentinel<Tag>(end_index().row);
+    }
+  }
+
+  /*
+   * The number of cells left in the direction is clipped to a whole number
+   * of steps in closed form
+   */
+  constexpr std::ptrdiff_t ssize() const noexcept {
+    const auto index = origin();
+    const auto rows = static_cast<std::ptrdiff_t>(*rows_);
+    const auto columns = static_cast<std::ptrdiff_t>(*columns_);
+    std::ptrdiff_t cells = 0;
+    if constexpr (kRowTag) {
+      cells = columns - index.column;
+    } else if constexpr (kColumnTag) {
+      cells = rows - index.row;
+    } else if constexpr (kDiagonalTag) {
+      cells = std::min(rows - index.row, columns - index.column);
+    } else {
+      static_assert(kAntidiagonalTag);
+      cells = std::min(rows - index.row, index.column + 1);
+    }
+    return ceil_div(cells, static_cast<std::ptrdiff_t>(*step_));
+  }
+
+  /*
+   * Index of the first element, dimensions of the underlying matrix and the
+   * number of cells between adjacent elements
+   */
+  constexpr utils::index origin() const noexcept {
+    return static_cast<utils::index>(index_);
+  }
+  constexpr std::size_t rows() const noexcept { return *rows_; }
+  constexpr std::size_t columns() const noexcept { return *columns_; }
+  constexpr std::size_t step() const noexcept { return *step_; }
+
+  constexpr decltype(auto) data() const noexcept
+    requires std::contiguous_iterator<decltype(begin())>
+  {
+    return std::to_address(begin());
+  }
+
+  /*
+   * Maximal span of elements adjacent in memory that starts with the n-th
+   * element of a non-empty rest of the range. Algorithms run memcpy or vector
+   * loops over the segments, see kernels::for_each_segment
+   */
+  constexpr auto segment(std::ptrdiff_t n) const
+    requires tagged_random_access_range_segmented_storage_proxy<StorageProxy,
+                                                                Tag> &&
+             (Step == 1)
+  {
+    return StorageProxy::segment(Tag{}, cell(n), this->ssize() - n);
+  }
+
+  /*
+   * Subrange outside of which the storage holds structural zeros only, so
+   * that algorithms can skip them. Computed in O(1) since a stripe crosses the
+   * band of stored diagonals once
+   */
+  constexpr decltype(auto) structural_nonzeros() const noexcept
+    requires tagged_random_access_range_banded_storage_proxy<StorageProxy> &&
+             (Step == 1)
+  {
+    const auto [lowest, highest] = StorageProxy::band();
+    const auto diagonal = origin().column - origin().row;
+    const auto size = this->ssize();
+
+    // The diagonal of the n-th element of the range is diagonal + n * step
+    constexpr std::ptrdiff_t step = kRowTag        ? 1
+                                    : kColumnTag   ? -1
+                                    : kDiagonalTag ? 0
+                                                   : -2;
+    std::ptrdiff_t first = 0;
+    std::ptrdiff_t last = size;
+    if constexpr (step > 0) {
+      first = ceil_div(lowest - diagonal, step);
+      last = floor_div(highest - diagonal, step) + 1;
+    } else if constexpr (step < 0) {
+      first = ceil_div(diagonal - highest, -step);
+      last = floor_div(diagonal - lowest, -step) + 1;
+    } else if (diagonal < lowest || diagonal > highest) {
+      last = 0;
+    }
+    first = std::clamp<std::ptrdiff_t>(first, 0, size);
+    last = std::clamp<std::ptrdiff_t>(last, first, size);
+    return std::ranges::subrange(begin() + first, begin() + last);
+  }
+
+ private:
+  constexpr utils::index end_index() const noexcept {
+    return cell(ssize() * static_cast<std::ptrdiff_t>(*step_));
   }
 
-  constexpr decltype(auto) end() const noexcept {
+  /*
+   * Index of the n-th cell from the origin in the direction
+   */
+  constexpr utils::index cell(std::ptrdiff_t n) const noexcept {
+    const auto index = origin();
     if constexpr (kRowTag) {
-      return begin() + (*columns_ - index_.row);
+      return {index.row, index.column + n};
     } else if constexpr (kColumnTag) {
-      return begin() + (*rows_ - index_.column);
+      return {index.row + n, index.column};
     } else if constexpr (kDiagonalTag) {
-      return begin() + std::min(*rows_ - index_.row, *columns_ - index_.column);
+      return {index.row + n, index.column + n};
     } else {
       static_assert(kAntidiagonalTag);
-      return begin() +
-             std::min(static_cast<std::ptrdiff_t>(*rows_) - index_.row,
-                      index_.column + 1);
+      return {index.row + n, index.column - n};
     }
   }
 
+  static constexpr std::ptrdiff_t floor_div(std::ptrdiff_t lhs,
+                                            std::ptrdiff_t rhs) noexcept {
+    return lhs / rhs - (lhs % rhs != 0 && lhs < 0);
+  }
+  static constexpr std::ptrdiff_t ceil_div(std::ptrdiff_t lhs,
+                                           std::ptrdiff_t rhs) noexcept {
+    return lhs / rhs + (lhs % rhs != 0 && lhs > 0);
+  }
+
  private:
-  utils::index index_;
+  utils::basic_index<Index> index_ = {0, 0};
 
   [[no_unique_address]] utils::conditionally_runtime<std::size_t, kDynamicRows,
-                                                     Rows> rows_;
+                                                     Rows> rows_ =
+      utils::runtime_if<kDynamicRows>(std::size_t());
   [[no_unique_address]] utils::conditionally_runtime<
-      std::size_t, kDynamicColumns, Columns> columns_;
+      std::size_t, kDynamicColumns, Columns> columns_ =
+      utils::runtime_if<kDynamicColumns>(std::size_t());
+  [[no_unique_address]] utils::conditionally_runtime<std::size_t, kDynamicStep,
+                                                     Step> step_ =
+      utils::runtime_if<kDynamicStep>(std::size_t(1));
 };
 
+namespace detail {
+
+template <std::size_t Step, std::size_t RangeStep>
+inline constexpr std::size_t kProductStep =
+    Step == std::dynamic_extent || RangeStep == std::dynamic_extent
+        ? std::dynamic_extent
+        : Step * RangeStep;
+
+}  // namespace detail
+
+/*
+ * Range of every step-th element of the range starting with its first one.
+ * The step is passed at runtime and must be positive. The iterators advance
+ * by whole steps, so the result keeps random access and the ranges of
+ * strided storage proxies stay strided
+ */
+template <typename Tag, typename StorageProxy, std::size_t Rows,
+          std::size_t Columns, std::size_t RangeStep, typename Index>
+constexpr decltype(auto) stride(
+    const tagged_random_access_range<Tag, StorageProxy, Rows, Columns,
+                                     RangeStep, Index>& range,
+    std::size_t step) noexcept {
+  return tagged_random_access_range<Tag, StorageProxy, Rows, Columns,
+                                    std::dynamic_extent, Index>(
+      Tag{}, range.origin(), static_cast<const StorageProxy&>(range),
+      range.rows(), range.columns(), step * range.step());
+}
+
+/*
+ * Range of every Step-th element of the range, with the step set in the type
+ */
+template <std::size_t Step, typename Tag, typename StorageProxy,
+          std::size_t Rows, std::size_t Columns, std::size_t RangeStep,
+          typename Index>
+  requires(Step != std::dynamic_extent)
+constexpr decltype(auto) stride(
+    const tagged_random_access_range<Tag, StorageProxy, Rows, Columns,
+                                     RangeStep, Index>& range) noexcept {
+  return tagged_random_access_range<Tag, StorageProxy, Rows, Columns,
+                                    detail::kProductStep<Step, RangeStep>,
+                                    Index>(
+      Tag{}, range.origin(), static_cast<const StorageProxy&>(range),
+      range.rows(), range.columns(), Step * range.step());
+}
+
+namespace detail {
+
+template <typename Range>
+struct static_size final {
+  static inline const constinit std::size_t kValue = std::dynamic_extent;
+};
+
+template <std::size_t Cells, std::size_t Step>
+inline constexpr std::size_t kStepsOf =
+    Cells == std::dynamic_extent || Step == std::dynamic_extent
+        ? std::dynamic_extent
+        : (Cells + Step - 1) / Step;
+
+template <typename StorageProxy, std::size_t Rows, std::size_t Columns,
+          std::size_t Step, typename Index>
+struct static_size<tagged_random_access_range<utils::kRowTag, StorageProxy,
+                                              Rows, Columns, Step, Index>>
+    final {
+  static inline const constinit std::size_t kValue = kStepsOf<Columns, Step>;
+};
+
+template <typename StorageProxy, std::size_t Rows, std::size_t Columns,
+          std::size_t Step, typename Index>
+struct static_size<tagged_random_access_range<utils::kColumnTag, StorageProxy,
+                                              Rows, Columns, Step, Index>>
+    final {
+  static inline const constinit std::size_t kValue = kStepsOf<Rows, Step>;
+};
+
+}  // namespace detail
+
+/*
+ * Number of elements of a whole row or column, e.g. as returned by
+ * matrix::row, if the dimensions of the matrix are stored in the type and
+ * std::dynamic_extent otherwise
+ */
+template <typename Range>
+inline constexpr std::size_t kStaticSizeOf =
+    detail::static_size<std::remove_cvref_t<Range>>::kValue;
+
 }  // namespace matrix_views::ranges
+
+template <typename Tag, typename StorageProxy, std::size_t Rows,
+          std::size_t Columns, std::size_t Step, typename Index>
+inline constexpr bool std::ranges::enable_borrowed_range<
+    matrix_views::ranges::tagged_random_access_range<
+        Tag, StorageProxy, Rows, Columns, Step, Index>> = true;
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cassert>
+#include <span>
+
+#include "iterators/tile_random_access_iterator.hpp"
+#include "ranges/base_random_access_range.hpp"
+#include "ranges/tagged_random_access_range.hpp"
+#include "utils/conditionally_runtime.hpp"
+#include "utils/tags.hpp"
+
+namespace matrix_views::ranges {
+
+/*
+ * Range of the square tiles of a matrix. Its elements are
+ * window_random_access_range objects sharing one storage proxy. Optionally
+ * stores the tile size and matrix dimensions in the type
+ *
+ * Walking a matrix tile by tile keeps column and diagonal stripes of a tile in
+ * the cache when the tile fits into it
+ */
+template <tagged_random_access_range_storage_proxy StorageProxy,
+          std::size_t TileSize = std::dynamic_extent,
+          std::size_t Rows = std::dynamic_extent,
+          std::size_t Columns = std::dynamic_extent>
+class tile_random_access_range final
+    : public base_random_access_range<
+          tile_random_access_range<StorageProxy, TileSize, Rows, Columns>>,
+      public std::ranges::view_base,
+      public StorageProxy {
+ private:
+  static inline const constinit bool kDynamicTileSize =
+      TileSize == std::dynamic_extent;
+  static_assert(TileSize != 0, "the tile size must be positive");
+  static inline const constinit bool kDynamicRows = Rows == std::dynamic_extent;
+  static inline const constinit bool kDynamicColumns =
+      Columns == std::dynamic_extent;
+
+  using iterator =
+      iterators::tile_random_access_iterator<StorageProxy, TileSize, Rows,
+                                             Columns>;
+
+ public:
+  constexpr tile_random_access_range() noexcept = default;
+  constexpr tile_random_access_range(utils::kTileTag,
+                                     StorageProxy storage_proxy) noexcept
+    requires(!kDynamicTileSize && !kDynamicRows && !kDynamicColumns)
+      : StorageProxy(std::move(storage_proxy)) {}
+  /*
+   * The tile size must be positive. The tile size and dimensions set in the
+   * type must match the ones passed
+   */
+  constexpr tile_random_access_range(utils::kTileTag,
+                                     StorageProxy storage_proxy,
+                                     std::size_t tile_size, std::size_t rows,
+                                     std::size_t columns) noexcept
+      : base_random_access_range<tile_random_access_range>(),
+        StorageProxy(std::move(storage_proxy)),
+        tile_size_(utils::runtime_if<kDynamicTileSize>(tile_size)),
+        rows_(utils::runtime_if<kDynamicRows>(rows)),
+        columns_(utils::runtime_if<kDynamicColumns>(columns)) {
+    assert(tile_size > 0 && *tile_size_ == tile_size);
+    assert(*rows_ == rows && *columns_ == columns);
+  }
+
+ public:
+  constexpr iterator begin() const noexcept { return make_iterator({0, 0}); }
+
+  constexpr iterator end() const noexcept {
+    if (*rows_ == 0 || *columns_ == 0) {
+      return begin();
+    }
+    return make_iterator(
+        {static_cast<std::ptrdiff_t>((*rows_ + *tile_size_ - 1) / *tile_size_),
+         0});
+  }
+
+ private:
+  constexpr iterator make_iterator(utils::index index) const noexcept {
+    return iterator(utils::kTile, index,
+                    static_cast<const StorageProxy&>(*this), *tile_size_,
+                    *rows_, *columns_);
+  }
+
+ private:
+  [[no_unique_address]] utils::conditionally_runtime<
+      std::size_t, kDynamicTileSize, TileSize> tile_size_ =
+      utils::runtime_if<kDynamicTileSize>(std::size_t());
+  [[no_unique_address]] utils::conditionally_runtime<std::size_t, kDynamicRows,
+                                                     Rows> rows_ =
+      utils::runtime_if<kDynamicRows>(std::size_t());
+  [[no_unique_address]] utils::conditionally_runtime<
+      std::size_t, kDynamicColumns, Columns> columns_ =
+      utils::runtime_if<kDynamicColumns>(std::size_t());
+};
+
+}  // namespace matrix_views::ranges
+
+template <typename StorageProxy, std::size_t TileSize, std::size_t Rows,
+          std::size_t Columns>
+inline constexpr bool std::ranges::enable_borrowed_range<
+    matrix_views::ranges::tile_random_access_range<StorageProxy, TileSize,
+                                                   Rows, Columns>> = true;
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <span>
+
+#include "iterators/stripe_random_access_iterator.hpp"
+#include "ranges/base_random_access_range.hpp"
+#include "ranges/tagged_random_access_range.hpp"
+#include "utils/conditionally_runtime.hpp"
+#include "utils/index.hpp"
+#include "utils/tags.hpp"
+
+namespace matrix_views::ranges {
+
+/*
+ * Rectangular window of a matrix starting at a set index. Its elements are the
+ * rows of the window as tagged_random_access_range objects sharing one storage
+ * proxy. Optionally stores window dimensions in the type
+ *
+ * Rows and columns of the window stop at its right and bottom edges, so a
+ * small enough window is traversed without leaving the cache
+ */
+template <tagged_random_access_range_storage_proxy StorageProxy,
+          std::size_t Rows = std::dynamic_extent,
+          std::size_t Columns = std::dynamic_extent>
+class window_random_access_range final
+    : public base_random_access_range<
+          window_random_access_range<StorageProxy, Rows, Columns>>,
+      public std::ranges::view_base,
+      public StorageProxy {
+ private:
+  static inline const constinit bool kDynamicRows = Rows == std::dynamic_extent;
+  static inline const constinit bool kDynamicColumns =
+      Columns == std::dynamic_extent;
+
+  template <typename Tag>
+  using iterator = iterators::stripe_random_access_iterator<Tag, StorageProxy>;
+
+ public:
+  constexpr window_random_access_range() noexcept = default;
+  constexpr window_random_access_range(
+      utils::index index, StorageProxy storage_proxy,
+      std::size_t rows = std::dynamic_extent,
+      std::size_t columns = std::dynamic_extent) noexcept
+      : base_random_access_range<window_random_access_range>(),
+        StorageProxy(std::move(storage_proxy)),
+        index_(index),
+        rows_(utils::runtime_if<kDynamicRows>(rows)),
+        columns_(utils::runtime_if<kDynamicColumns>(columns)) {}
+
+ public:
+  constexpr std::size_t rows() const noexcept { return *rows_; }
+  constexpr std::size_t columns() const noexcept { return *columns_; }
+
+  /*
+   * Element at the index relative to the top left corner of the window
+   */
+  constexpr decltype(auto) operator()(utils::index index) const {
+    return StorageProxy::operator()(
+        {index_.row + index.row, index_.column + index.column});
+  }
+
+  constexpr iterator<utils::kRowTag> begin() const noexcept {
+    return make_iterator(utils::kRow, index_);
+  }
+
+  constexpr iterator<utils::kRowTag> end() const noexcept {
+    return make_iterator(
+        utils::kRow,
+        {index_.row + static_cast<std::ptrdiff_t>(*rows_), index_.column});
+  }
+
+  /*
+   * Range of the rows or the columns of the window
+   */
+  template <typename Tag>
+    requires std::same_as<Tag, utils::kRowTag> ||
+             std::same_as<Tag, utils::kColumnTag>
+  constexpr decltype(auto) stripes(Tag) const noexcept {
+    if constexpr (std::is_same_v<Tag, utils::kRowTag>) {
+      return std::ranges::subrange(begin(), end());
+    } else {
+      return std::ranges::subrange(
+          make_iterator(utils::kColumn, index_),
+          make_iterator(utils::kColumn,
+                        {index_.row, index_.column + static_cast<std::ptrdiff_t>(
+                                                         *columns_)}));
+    }
+  }
+
+ private:
+  template <typename Tag>
+  constexpr iterator<Tag> make_iterator(Tag,
+                                        utils::index index) const noexcept {
+    return iterator<Tag>(Tag{}, index, static_cast<const StorageProxy&>(*this),
+                         static_cast<std::size_t>(index_.row) + *rows_,
+                         static_cast<std::size_t>(index_.column) + *columns_);
+  }
+
+ private:
+  utils::index index_;
+
+  [[no_unique_address]] utils::conditionally_runtime<std::size_t, kDynamicRows,
+                                                     Rows> rows_ =
+      utils::runtime_if<kDynamicRows>(std::size_t());
+  [[no_unique_address]] utils::conditionally_runtime<
+      std::size_t, kDynamicColumns, Columns> columns_ =
+      utils::runtime_if<kDynamicColumns>(std::size_t());
+};
+
+}  // namespace matrix_views::ranges
+
+template <typename StorageProxy, std::size_t Rows, std::size_t Columns>
+inline constexpr bool std::ranges::enable_borrowed_range<
+    matrix_views::ranges::window_random_access_range<StorageProxy, Rows,
+                                                     Columns>> = true;
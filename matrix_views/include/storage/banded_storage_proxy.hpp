@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cassert>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "utils/conditionally_runtime.hpp"
+#include "utils/index.hpp"
+#include "utils/tags.hpp"
+
+namespace matrix_views::storage {
+
+/*
+ * Read-only storage proxy over a band matrix with the given number of
+ * subdiagonals and superdiagonals, e.g. 1 and 1 for a tridiagonal matrix.
+ * Optionally stores the bandwidths in the type
+ *
+ * The band is packed row by row with subdiagonals + superdiagonals + 1
+ * elements per row, so the i-th row holds the columns from i - subdiagonals to
+ * i + superdiagonals. The slots of the first and the last rows that fall
+ * outside of the matrix are left unused. Accessing a cell maps its index to
+ * the packed offset in O(1) and yields zero for the cells outside of the band
+ */
+template <typename T, std::size_t Subdiagonals = std::dynamic_extent,
+          std::size_t Superdiagonals = std::dynamic_extent>
+class banded_storage_proxy {
+ private:
+  static inline const constinit bool kDynamicSubdiagonals =
+      Subdiagonals == std::dynamic_extent;
+  static inline const constinit bool kDynamicSuperdiagonals =
+      Superdiagonals == std::dynamic_extent;
+
+ public:
+  constexpr banded_storage_proxy() noexcept = default;
+  constexpr explicit banded_storage_proxy(T* data) noexcept
+    requires(!kDynamicSubdiagonals && !kDynamicSuperdiagonals)
+      : data_(data) {}
+  /*
+   * The bandwidths set in the type must match the ones passed
+   */
+  constexpr banded_storage_proxy(T* data, std::size_t subdiagonals,
+                                 std::size_t superdiagonals) noexcept
+      : data_(data),
+        subdiagonals_(utils::runtime_if<kDynamicSubdiagonals>(subdiagonals)),
+        superdiagonals_(
+            utils::runtime_if<kDynamicSuperdiagonals>(superdiagonals)) {
+    assert(*subdiagonals_ == subdiagonals &&
+           *superdiagonals_ == superdiagonals);
+  }
+
+ public:
+  using reference = std::remove_cv_t<T>;
+  using value_type = std::remove_cv_t<T>;
+  using pointer = T*;
+
+  constexpr reference operator()(utils::index index) const noexcept {
+    return stored(index) ? data_[offset(index)] : value_type();
+  }
+
+  constexpr pointer data() const noexcept { return data_; }
+
+  /*
+   * Offset of a cell of the band in the packed array
+   */
+  constexpr std::ptrdiff_t offset(utils::index index) const noexcept {
+    const auto [lowest, highest] = band();
+    return index.row * (highest - lowest + 1) + index.column - index.row -
+           lowest;
+  }
+
+  constexpr bool stored(utils::index index) const noexcept {
+    const auto [lowest, highest] = band();
+    const auto diagonal = index.column - index.row;
+    return lowest <= diagonal && diagonal <= highest;
+  }
+
+  /*
+   * Lowest and highest diagonal, as column - row, that holds stored cells
+   */
+  constexpr std::pair<std::ptrdiff_t, std::ptrdiff_t> band() const noexcept {
+    return {-static_cast<std::ptrdiff_t>(*subdiagonals_),
+            static_cast<std::ptrdiff_t>(*superdiagonals_)};
+  }
+
+ private:
+  T* data_ = nullptr;
+
+  [[no_unique_address]] utils::conditionally_runtime<
+      std::size_t, kDynamicSubdiagonals, Subdiagonals> subdiagonals_ =
+      utils::runtime_if<kDynamicSubdiagonals>(std::size_t());
+  [[no_unique_address]] utils::conditionally_runtime<
+      std::size_t, kDynamicSuperdiagonals, Superdiagonals> superdiagonals_ =
+      utils::runtime_if<kDynamicSuperdiagonals>(std::size_t());
+};
+
+}  // namespace matrix_views::storage
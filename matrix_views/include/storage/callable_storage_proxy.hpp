@@ -1,9 +1,9 @@
 #pragma once
 
 #include <concepts>
-#include <optional>
 
 #include "utils/index.hpp"
+#include "utils/semiregular_box.hpp"
 
 namespace matrix_views::storage {
 
@@ -16,8 +16,8 @@ concept callable_storage_proxy_callable =
     std::invocable<const StorageProxy, utils::index>;
 
 /*
- * Tagged iterator class with a set direction. Implements iterator movement but
- * leaves dereferencing unimplemented
+ * Storage proxy that implements data access via a callable. Empty callables
+ * take no space and default construction adds no checks to the access
  */
 template <callable_storage_proxy_callable Callable>
 class callable_storage_proxy {
@@ -26,30 +26,16 @@ class callable_storage_proxy {
   constexpr callable_storage_proxy(Callable storage_proxy) noexcept
       : storage_proxy_(std::move(storage_proxy)) {}
 
-  constexpr callable_storage_proxy(const callable_storage_proxy& that) =
-      default;
-  constexpr callable_storage_proxy& operator=(
-      const callable_storage_proxy& that) {
-    this->storage_proxy_ = that.storage_proxy_;
-    return *this;
-  }
-
-  constexpr callable_storage_proxy(callable_storage_proxy&& that) = default;
-  constexpr callable_storage_proxy& operator=(callable_storage_proxy&& that) {
-    this->storage_proxy_ = std::move(that.storage_proxy_);
-    return *this;
-  }
-
  public:
   using reference = std::invoke_result_t<Callable, utils::index>;
   using value_type = std::remove_cvref_t<reference>;
 
   constexpr reference operator()(utils::index index) const {
-    return storage_proxy_.value()(index);
+    return (*storage_proxy_)(index);
   }
 
  private:
-  std::optional<Callable> storage_proxy_;
+  [[no_unique_address]] utils::semiregular_box<Callable> storage_proxy_;
 };
 
 }  // namespace matrix_views::storage
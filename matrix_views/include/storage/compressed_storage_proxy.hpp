@@ -0,0 +1,77 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+
+#include "utils/index.hpp"
+#include "utils/tags.hpp"
+
+namespace matrix_views::storage {
+
+/*
+ * Read-only storage proxy over a compressed sparse matrix. Row-major layout
+ * stands for compressed sparse rows (CSR) and column-major layout for
+ * compressed sparse columns (CSC)
+ *
+ * The nonzeros of the i-th major stripe are at positions [first(i), last(i))
+ * of the index and value arrays, sorted by their minor index. Accessing a
+ * cell binary searches its stripe and yields zero for the cells not stored
+ */
+template <typename T, typename Layout = utils::kRowMajorTag>
+class compressed_storage_proxy {
+ private:
+  static inline const constinit bool kRowMajor =
+      std::is_same_v<Layout, utils::kRowMajorTag>;
+
+ public:
+  constexpr compressed_storage_proxy() noexcept = default;
+  constexpr compressed_storage_proxy(const std::ptrdiff_t* offsets,
+                                     const std::ptrdiff_t* indices,
+                                     const T* values) noexcept
+      : offsets_(offsets), indices_(indices), values_(values) {}
+
+ public:
+  using reference = T;
+  using value_type = T;
+
+  constexpr reference operator()(utils::index index) const noexcept {
+    const auto major = kRowMajor ? index.row : index.column;
+    const auto minor = kRowMajor ? index.column : index.row;
+
+    const auto begin = indices_ + first(major);
+    const auto end = indices_ + last(major);
+    const auto it = std::lower_bound(begin, end, minor);
+    return it != end && *it == minor ? values_[it - indices_] : T();
+  }
+
+  constexpr std::ptrdiff_t first(std::ptrdiff_t major) const noexcept {
+    return offsets_[major];
+  }
+  constexpr std::ptrdiff_t last(std::ptrdiff_t major) const noexcept {
+    return offsets_[major + 1];
+  }
+
+  constexpr utils::index index(std::ptrdiff_t major,
+                               std::ptrdiff_t position) const noexcept {
+    return kRowMajor ? utils::index{major, indices_[position]}
+                     : utils::index{indices_[position], major};
+  }
+  constexpr reference value(std::ptrdiff_t position) const noexcept {
+    return values_[position];
+  }
+
+  static constexpr bool compressed(utils::kRowTag) noexcept {
+    return kRowMajor;
+  }
+  static constexpr bool compressed(utils::kColumnTag) noexcept {
+    return !kRowMajor;
+  }
+
+ private:
+  const std::ptrdiff_t* offsets_ = nullptr;
+  const std::ptrdiff_t* indices_ = nullptr;
+  const T* values_ = nullptr;
+};
+
+}  // namespace matrix_views::storage
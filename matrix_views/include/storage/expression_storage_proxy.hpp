@@ -0,0 +1,92 @@
+#pragma once
+
+#include <concepts>
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "utils/index.hpp"
+#include "utils/semiregular_box.hpp"
+
+namespace matrix_views::storage {
+
+/*
+ * Concept representing a storage proxy that can be an operand of
+ * expression_storage_proxy
+ */
+template <typename StorageProxy>
+concept expression_storage_proxy_operand =
+    std::invocable<const StorageProxy, utils::index> &&
+    std::copy_constructible<StorageProxy>;
+
+/*
+ * Storage proxy that applies a function to the cells of the operand storage
+ * proxies at the same index. Nothing is evaluated until a cell is accessed,
+ * so nested expressions fuse into one call per cell without temporaries
+ */
+template <std::copy_constructible Function,
+          expression_storage_proxy_operand... StorageProxies>
+  requires std::regular_invocable<
+      const Function&,
+      std::invoke_result_t<const StorageProxies, utils::index>...>
+class expression_storage_proxy {
+ public:
+  constexpr expression_storage_proxy() = default;
+  constexpr expression_storage_proxy(Function function,
+                                     StorageProxies... storage_proxies)
+      : function_(std::move(function)),
+        storage_proxies_(std::move(storage_proxies)...) {}
+
+ public:
+  using reference = std::invoke_result_t<
+      const Function&,
+      std::invoke_result_t<const StorageProxies, utils::index>...>;
+  using value_type = std::remove_cvref_t<reference>;
+
+  constexpr reference operator()(utils::index index) const {
+    return std::apply(
+        [&](const auto&... storage_proxies) -> reference {
+          return std::invoke(*function_, storage_proxies(index)...);
+        },
+        storage_proxies_);
+  }
+
+ private:
+  [[no_unique_address]] utils::semiregular_box<Function> function_;
+  std::tuple<StorageProxies...> storage_proxies_;
+};
+
+/*
+ * Concept representing a scalar that expressions broadcast to every cell
+ */
+template <typename Scalar>
+concept expression_scalar = std::is_arithmetic_v<std::remove_cvref_t<Scalar>>;
+
+/*
+ * Function that applies a binary operation to its argument and a scalar,
+ * with the scalar on the left or on the right
+ */
+template <typename Operation, expression_scalar Scalar, bool ScalarOnLeft>
+class scalar_operation {
+ public:
+  constexpr scalar_operation() = default;
+  constexpr scalar_operation(Operation operation, Scalar scalar)
+      : operation_(std::move(operation)), scalar_(scalar) {}
+
+ public:
+  template <typename T>
+  constexpr decltype(auto) operator()(T&& value) const {
+    if constexpr (ScalarOnLeft) {
+      return operation_(scalar_, std::forward<T>(value));
+    } else {
+      return operation_(std::forward<T>(value), scalar_);
+    }
+  }
+
+ private:
+  [[no_unique_address]] Operation operation_;
+  Scalar scalar_ = Scalar();
+};
+
+}  // namespace matrix_views::storage
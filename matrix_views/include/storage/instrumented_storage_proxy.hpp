@@ -0,0 +1,109 @@
+#pragma once
+
+#include <concepts>
+#include <type_traits>
+#include <utility>
+
+#include "storage/callable_storage_proxy.hpp"
+#include "utils/access_profiler.hpp"
+#include "utils/index.hpp"
+#include "utils/semiregular_box.hpp"
+
+namespace matrix_views::storage {
+
+/*
+ * Storage proxy that records every access to the wrapped proxy into the
+ * utils::access_profiler of the Site, optionally with the timestamp counter
+ * ticks spent in the access
+ *
+ * Hides the wrapped proxy behind its call operator, so iterators over strided
+ * proxies access them by index as well. With Enabled off, which is the default
+ * unless MATRIX_VIEWS_INSTRUMENTATION is set, it derives from the wrapped
+ * proxy and adds nothing to it. Proxies that cannot be derived from, i.e.
+ * function pointers and final classes, are held and called instead, so only
+ * their call operator is kept
+ */
+template <callable_storage_proxy_callable StorageProxy, typename Site = void,
+          bool Timing = false, bool Enabled = utils::kInstrumentation>
+class instrumented_storage_proxy {
+ private:
+  using profiler = utils::access_profiler<Site>;
+
+ public:
+  constexpr instrumented_storage_proxy() noexcept = default;
+  constexpr instrumented_storage_proxy(StorageProxy storage_proxy) noexcept
+      : storage_proxy_(std::move(storage_proxy)) {}
+
+ public:
+  using reference = std::invoke_result_t<const StorageProxy, utils::index>;
+  using value_type = std::remove_cvref_t<reference>;
+
+  constexpr reference operator()(utils::index index) const {
+    if (std::is_constant_evaluated()) {
+      return (*storage_proxy_)(index);
+    }
+
+    if constexpr (Timing) {
+      const auto start = profiler::ticks();
+      reference result = (*storage_proxy_)(index);
+      profiler::record(index, profiler::ticks() - start);
+      return result;
+    } else {
+      profiler::record(index);
+      return (*storage_proxy_)(index);
+    }
+  }
+
+ private:
+  [[no_unique_address]] utils::semiregular_box<StorageProxy> storage_proxy_;
+};
+
+template <callable_storage_proxy_callable StorageProxy, typename Site,
+          bool Timing>
+class instrumented_storage_proxy<StorageProxy, Site, Timing, false> {
+ public:
+  constexpr instrumented_storage_proxy() noexcept = default;
+  constexpr instrumented_storage_proxy(StorageProxy storage_proxy) noexcept
+      : storage_proxy_(std::move(storage_proxy)) {}
+
+ public:
+  using reference = std::invoke_result_t<const StorageProxy, utils::index>;
+  using value_type = std::remove_cvref_t<reference>;
+
+  constexpr reference operator()(utils::index index) const {
+    return (*storage_proxy_)(index);
+  }
+
+ private:
+  [[no_unique_address]] utils::semiregular_box<StorageProxy> storage_proxy_;
+};
+
+template <callable_storage_proxy_callable StorageProxy, typename Site,
+          bool Timing>
+  requires(std::is_class_v<StorageProxy> && !std::is_final_v<StorageProxy>)
+class instrumented_storage_proxy<StorageProxy, Site, Timing, false>
+    : public StorageProxy {
+ public:
+  constexpr instrumented_storage_proxy() noexcept = default;
+
+  /*
+   * Takes the wrapped proxy only, not the types derived from this one
+   */
+  template <std::same_as<StorageProxy> That>
+  constexpr instrumented_storage_proxy(That storage_proxy) noexcept
+      : StorageProxy(std::move(storage_proxy)) {}
+};
+
+/*
+ * Instrumented storage proxy over the proxy. Proxies instrumented with the
+ * same Site count into one profile
+ */
+template <typename Site = void, bool Timing = false,
+          bool Enabled = utils::kInstrumentation, typename StorageProxy>
+constexpr instrumented_storage_proxy<StorageProxy, Site, Timing, Enabled>
+instrumented(StorageProxy storage_proxy) noexcept {
+  return instrumented_storage_proxy<StorageProxy, Site, Timing, Enabled>(
+      std::move(storage_proxy));
+}
+
+}  // namespace matrix_views::storage
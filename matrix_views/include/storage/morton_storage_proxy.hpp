@@ -0,0 +1,87 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "utils/index.hpp"
+#include "utils/space_filling_curves.hpp"
+
+namespace matrix_views::storage {
+
+/*
+ * Storage proxy over a matrix stored in Z-order, i.e. the element of a cell is
+ * at the Morton code of its index. Use a const T for read-only access
+ *
+ * Aligned square blocks of any size are contiguous, so walking the matrix in
+ * Z-order walks the memory sequentially and rows and columns alike touch a
+ * block of cache lines around the cell
+ *
+ * Only the low bits that both dimensions take are interleaved and the high
+ * bits of the longer dimension are put above them, i.e. a matrix wider than
+ * tall is stored as a row of Z-ordered squares. So the storage takes less
+ * than twice the number of cells per dimension rather than the square of
+ * the longer one
+ */
+template <typename T>
+class morton_storage_proxy {
+ public:
+  constexpr morton_storage_proxy() noexcept = default;
+  constexpr morton_storage_proxy(T* data, std::size_t rows,
+                                 std::size_t columns) noexcept
+      : data_(data), shared_bits_(shared_bits(rows, columns)) {}
+
+ public:
+  using reference = T&;
+  using value_type = std::remove_cv_t<T>;
+  using pointer = T*;
+
+  constexpr reference operator()(utils::index index) const noexcept {
+    const auto mask = (std::ptrdiff_t(1) << shared_bits_) - 1;
+    // The shorter dimension has no bits above the shared ones
+    const auto high =
+        static_cast<std::uint64_t>((index.row | index.column) >> shared_bits_);
+    return data_[utils::morton_encode({index.row & mask, index.column & mask}) |
+                 high << (2 * shared_bits_)];
+  }
+
+  /*
+   * Element at the position along the Z-order curve over the aligned square
+   * covering the matrix. Lets Morton iterators skip encoding the index of
+   * every cell they visit
+   */
+  constexpr reference at(std::uint64_t position) const noexcept {
+    const auto low = position & ((std::uint64_t(1) << (2 * shared_bits_)) - 1);
+    const auto high = position >> (2 * shared_bits_);
+    return data_[low | (utils::detail::compact_bits(high) |
+                        utils::detail::compact_bits(high >> 1))
+                           << (2 * shared_bits_)];
+  }
+
+  constexpr pointer data() const noexcept { return data_; }
+
+  /*
+   * Number of elements to allocate for a rows x columns matrix, i.e. the
+   * area of the aligned 2^i x 2^j rectangle covering it
+   */
+  static constexpr std::size_t size(std::size_t rows,
+                                    std::size_t columns) noexcept {
+    return rows == 0 || columns == 0
+               ? 0
+               : std::size_t(1) << (utils::curve_order(rows, 1) +
+                                    utils::curve_order(1, columns));
+  }
+
+ private:
+  static constexpr int shared_bits(std::size_t rows,
+                                   std::size_t columns) noexcept {
+    return std::min(utils::curve_order(rows, 1), utils::curve_order(1, columns));
+  }
+
+ private:
+  T* data_ = nullptr;
+  int shared_bits_ = 0;
+};
+
+}  // namespace matrix_views::storage
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <span>
+#include <type_traits>
+
+#include "storage/packed_triangular_storage_proxy.hpp"
+#include "utils/index.hpp"
+#include "utils/tags.hpp"
+
+namespace matrix_views::storage {
+
+/*
+ * Storage proxy over a symmetric square matrix of the given size that stores
+ * only the upper or the lower triangle packed row by row. Optionally stores
+ * the size in the type. Use a const T for read-only access
+ *
+ * Accessing a cell of the other triangle reads and writes its mirror, so every
+ * cell references a stored element
+ */
+template <typename T, packed_storage_proxy_triangle Triangle = utils::kUpperTag,
+          std::size_t Size = std::dynamic_extent>
+class packed_symmetric_storage_proxy {
+ private:
+  static inline const constinit bool kUpper =
+      std::is_same_v<Triangle, utils::kUpperTag>;
+
+ public:
+  constexpr packed_symmetric_storage_proxy() noexcept = default;
+  constexpr explicit packed_symmetric_storage_proxy(T* data) noexcept
+    requires(Size != std::dynamic_extent)
+      : triangle_(data) {}
+  /*
+   * The size set in the type must match the one passed
+   */
+  constexpr packed_symmetric_storage_proxy(T* data, std::size_t size) noexcept
+      : triangle_(data, size) {}
+
+ public:
+  using reference = T&;
+  using value_type = std::remove_cv_t<T>;
+  using pointer = T*;
+
+  constexpr reference operator()(utils::index index) const noexcept {
+    return data()[offset(index)];
+  }
+
+  constexpr pointer data() const noexcept { return triangle_.data(); }
+
+  /*
+   * Offset of a cell or of its mirror in the packed array
+   */
+  constexpr std::ptrdiff_t offset(utils::index index) const noexcept {
+    return triangle_.stored(index)
+               ? triangle_.offset(index)
+               : triangle_.offset({index.column, index.row});
+  }
+
+ private:
+  packed_triangular_storage_proxy<T, Triangle, Size> triangle_;
+};
+
+}  // namespace matrix_views::storage
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cassert>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "utils/conditionally_runtime.hpp"
+#include "utils/index.hpp"
+#include "utils/tags.hpp"
+
+namespace matrix_views::storage {
+
+/*
+ * Concept representing the set of valid triangle tags for packed storage
+ */
+template <typename Triangle>
+concept packed_storage_proxy_triangle =
+    std::same_as<Triangle, utils::kUpperTag> ||
+    std::same_as<Triangle, utils::kLowerTag>;
+
+/*
+ * Read-only storage proxy over an upper or lower triangular square matrix of
+ * the given size packed row by row into size * (size + 1) / 2 elements.
+ * Optionally stores the size in the type
+ *
+ * Accessing a cell maps its index to the packed offset in O(1) and yields zero
+ * for the cells of the other triangle
+ */
+template <typename T, packed_storage_proxy_triangle Triangle = utils::kUpperTag,
+          std::size_t Size = std::dynamic_extent>
+class packed_triangular_storage_proxy {
+ private:
+  static inline const constinit bool kDynamicSize = Size == std::dynamic_extent;
+  static inline const constinit bool kUpper =
+      std::is_same_v<Triangle, utils::kUpperTag>;
+
+ public:
+  constexpr packed_triangular_storage_proxy() noexcept = default;
+  constexpr explicit packed_triangular_storage_proxy(T* data) noexcept
+    requires(!kDynamicSize)
+      : data_(data) {}
+  /*
+   * The size set in the type must match the one passed
+   */
+  constexpr packed_triangular_storage_proxy(T* data, std::size_t size) noexcept
+      : data_(data), size_(utils::runtime_if<kDynamicSize>(size)) {
+    assert(*size_ == size);
+  }
+
+ public:
+  using reference = std::remove_cv_t<T>;
+  using value_type = std::remove_cv_t<T>;
+  using pointer = T*;
+
+  constexpr reference operator()(utils::index index) const noexcept {
+    return stored(index) ? data_[offset(index)] : value_type();
+  }
+
+  constexpr pointer data() const noexcept { return data_; }
+
+  /*
+   * Offset of a cell of the stored triangle in the packed array
+   */
+  constexpr std::ptrdiff_t offset(utils::index index) const noexcept {
+    if constexpr (kUpper) {
+      const auto size = static_cast<std::ptrdiff_t>(*size_);
+      return index.row * (2 * size - index.row + 1) / 2 + index.column -
+             index.row;
+    } else {
+      return index.row * (index.row + 1) / 2 + index.column;
+    }
+  }
+
+  constexpr bool stored(utils::index index) const noexcept {
+    return kUpper ? index.column >= index.row : index.column <= index.row;
+  }
+
+  /*
+   * Lowest and highest diagonal, as column - row, that holds stored cells
+   */
+  constexpr std::pair<std::ptrdiff_t, std::ptrdiff_t> band() const noexcept {
+    const auto size = static_cast<std::ptrdiff_t>(*size_);
+    return kUpper ? std::pair<std::ptrdiff_t, std::ptrdiff_t>{0, size - 1}
+                  : std::pair<std::ptrdiff_t, std::ptrdiff_t>{1 - size, 0};
+  }
+
+ private:
+  T* data_ = nullptr;
+
+  [[no_unique_address]] utils::conditionally_runtime<std::size_t, kDynamicSize,
+                                                     Size> size_ =
+      utils::runtime_if<kDynamicSize>(std::size_t());
+};
+
+}  // namespace matrix_views::storage
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <concepts>
+#include <type_traits>
+#include <utility>
+
+#include "utils/index.hpp"
+
+namespace matrix_views::storage {
+
+/*
+ * Storage proxy that accesses the cells of another one at a fixed shift of
+ * the index
+ */
+template <typename StorageProxy>
+  requires std::invocable<const StorageProxy, utils::index>
+class shifted_storage_proxy {
+ public:
+  constexpr shifted_storage_proxy() = default;
+  constexpr shifted_storage_proxy(StorageProxy storage_proxy,
+                                  utils::index shift)
+      : storage_proxy_(std::move(storage_proxy)), shift_(shift) {}
+
+ public:
+  using reference = std::invoke_result_t<const StorageProxy, utils::index>;
+  using value_type = std::remove_cvref_t<reference>;
+
+  constexpr reference operator()(utils::index index) const {
+    return storage_proxy_(
+        {index.row + shift_.row, index.column + shift_.column});
+  }
+
+  /*
+   * Segment of the proxy at the shifted index, if it has segments
+   */
+  template <typename Tag>
+  constexpr auto segment(Tag, utils::index index, std::ptrdiff_t size) const
+    requires requires(const StorageProxy storage_proxy) {
+      storage_proxy.segment(Tag{}, index, size);
+    }
+  {
+    return storage_proxy_.segment(
+        Tag{}, {index.row + shift_.row, index.column + shift_.column}, size);
+  }
+
+  /*
+   * Folds another shift into this one instead of nesting the proxies
+   */
+  constexpr shifted_storage_proxy shifted(utils::index index) const {
+    return shifted_storage_proxy(
+        storage_proxy_, {shift_.row + index.row, shift_.column + index.column});
+  }
+
+ private:
+  StorageProxy storage_proxy_;
+  utils::index shift_ = {0, 0};
+};
+
+/*
+ * Storage proxy whose {0, 0} is the given index of the storage proxy. Uses
+ * the shifted() member of the proxy if it has one, e.g. strided_storage_proxy
+ * advances its pointer, and wraps the proxy into shifted_storage_proxy
+ * otherwise
+ */
+template <typename StorageProxy>
+  requires std::invocable<const StorageProxy, utils::index>
+constexpr decltype(auto) shifted(const StorageProxy& storage_proxy,
+                                 utils::index index) {
+  if constexpr (requires { storage_proxy.shifted(index); }) {
+    return storage_proxy.shifted(index);
+  } else {
+    return shifted_storage_proxy<StorageProxy>(storage_proxy, index);
+  }
+}
+
+}  // namespace matrix_views::storage
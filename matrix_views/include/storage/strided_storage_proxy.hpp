@@ -0,0 +1,125 @@
+#pragma once
+
+#include <span>
+
+#include "utils/conditionally_runtime.hpp"
+#include "utils/index.hpp"
+#include "utils/tags.hpp"
+
+namespace matrix_views::storage {
+
+/*
+ * Storage proxy over a pointer with a row stride and a column stride.
+ * Optionally stores the strides in the type. Use a const T for read-only access
+ *
+ * Unlike callable_storage_proxy, it exposes the underlying pointer so that
+ * iterators can advance it by a constant step instead of recomputing the
+ * offset of every element
+ */
+template <typename T, std::size_t RowStride = std::dynamic_extent,
+          std::size_t ColumnStride = std::dynamic_extent>
+class strided_storage_proxy {
+ private:
+  static inline const constinit bool kDynamicRowStride =
+      RowStride == std::dynamic_extent;
+  static inline const constinit bool kDynamicColumnStride =
+      ColumnStride == std::dynamic_extent;
+
+ public:
+  constexpr strided_storage_proxy() noexcept = default;
+  constexpr strided_storage_proxy(
+      T* data, std::size_t row_stride = std::dynamic_extent,
+      std::size_t column_stride = std::dynamic_extent) noexcept
+      : data_(data),
+        row_stride_(utils::runtime_if<kDynamicRowStride>(row_stride)),
+        column_stride_(utils::runtime_if<kDynamicColumnStride>(column_stride)) {
+  }
+
+ public:
+  using reference = T&;
+  using value_type = std::remove_cv_t<T>;
+  using pointer = T*;
+
+  constexpr reference operator()(utils::index index) const noexcept {
+    return data_[offset(index)];
+  }
+
+  constexpr pointer data() const noexcept { return data_; }
+
+  constexpr std::ptrdiff_t offset(utils::index index) const noexcept {
+    return index.row * static_cast<std::ptrdiff_t>(*row_stride_) +
+           index.column * static_cast<std::ptrdiff_t>(*column_stride_);
+  }
+
+  constexpr void advance(std::ptrdiff_t offset) noexcept { data_ += offset; }
+
+  /*
+   * Proxy whose {0, 0} is the given index of this one. Folds the shift into
+   * the pointer
+   */
+  constexpr strided_storage_proxy shifted(utils::index index) const noexcept {
+    return strided_storage_proxy(data_ + offset(index), *row_stride_,
+                                 *column_stride_);
+  }
+
+  /*
+   * Proxy of the transposed matrix. Swaps the strides, so the rows of the
+   * transposed matrix are as contiguous as the columns of this one
+   */
+  constexpr strided_storage_proxy<T, ColumnStride, RowStride> transposed()
+      const noexcept {
+    return strided_storage_proxy<T, ColumnStride, RowStride>(
+        data_, *column_stride_, *row_stride_);
+  }
+
+  constexpr std::ptrdiff_t stride(utils::kRowTag) const noexcept {
+    return static_cast<std::ptrdiff_t>(*column_stride_);
+  }
+  constexpr std::ptrdiff_t stride(utils::kColumnTag) const noexcept {
+    return static_cast<std::ptrdiff_t>(*row_stride_);
+  }
+  constexpr std::ptrdiff_t stride(utils::kDiagonalTag) const noexcept {
+    return stride(utils::kColumn) + stride(utils::kRow);
+  }
+  constexpr std::ptrdiff_t stride(utils::kAntidiagonalTag) const noexcept {
+    return stride(utils::kColumn) - stride(utils::kRow);
+  }
+
+  /*
+   * Maximal run of elements adjacent in memory among the size elements from
+   * the index in the direction of the tag. Either all of them or the first
+   * one only, depending on the stride
+   */
+  template <typename Tag>
+  constexpr std::span<T> segment(Tag, utils::index index,
+                                 std::ptrdiff_t size) const noexcept {
+    return std::span<T>(data_ + offset(index),
+                        stride(Tag{}) == 1 ? static_cast<std::size_t>(size)
+                                           : std::size_t(1));
+  }
+
+  static constexpr bool contiguous(utils::kRowTag) noexcept {
+    return ColumnStride == 1;
+  }
+  static constexpr bool contiguous(utils::kColumnTag) noexcept {
+    return RowStride == 1;
+  }
+  static constexpr bool contiguous(utils::kDiagonalTag) noexcept {
+    return false;
+  }
+  static constexpr bool contiguous(utils::kAntidiagonalTag) noexcept {
+    return false;
+  }
+
+ private:
+  T* data_ = nullptr;
+
+  [[no_unique_address]] utils::conditionally_runtime<
+      std::size_t, kDynamicRowStride, RowStride> row_stride_ =
+      utils::runtime_if<kDynamicRowStride>(std::size_t());
+  [[no_unique_address]] utils::conditionally_runtime<
+      std::size_t, kDynamicColumnStride, ColumnStride> column_stride_ =
+      utils::runtime_if<kDynamicColumnStride>(std::size_t());
+};
+
+}  // namespace matrix_views::storage
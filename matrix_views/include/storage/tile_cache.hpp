@@ -0,0 +1,201 @@
+#pragma once
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <filesystem>
+#include <list>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+namespace matrix_views::storage {
+
+/*
+ * Counters of the tile lookups that reached a tile_cache
+ */
+struct tile_cache_stats final {
+  std::size_t hits = 0;
+  std::size_t misses = 0;
+  std::size_t evictions = 0;
+  std::size_t prefetches = 0;
+};
+
+/*
+ * Bounded least recently used cache of the square tiles of a matrix stored
+ * in a file. Not thread-safe
+ *
+ * The file holds the tiles of the tile grid in row-major order and the
+ * elements of every tile in row-major order. Tiles at the bottom and right
+ * edges are padded to the full tile size. The cache keeps as many tiles as
+ * fit into the byte budget but at least one. Throws std::system_error if the
+ * file cannot be read and std::length_error if it is smaller than the matrix
+ *
+ * Tiles are mapped from the file rather than read into buffers, so a miss
+ * on a file in the page cache costs the mapping but no copy. The file must
+ * not shrink while it is mapped
+ */
+template <typename T>
+  requires std::is_trivially_copyable_v<T>
+class tile_cache final {
+ private:
+  struct entry final {
+    std::ptrdiff_t tile = 0;
+    void* address = nullptr;
+    std::size_t length = 0;
+  };
+
+ public:
+  tile_cache(const std::filesystem::path& path, std::size_t rows,
+             std::size_t columns, std::size_t tile_size,
+             std::size_t byte_budget)
+      : tile_size_(static_cast<std::ptrdiff_t>(tile_size)),
+        tile_rows_(static_cast<std::ptrdiff_t>((rows + tile_size - 1) /
+                                               tile_size)),
+        tile_columns_(static_cast<std::ptrdiff_t>((columns + tile_size - 1) /
+                                                  tile_size)),
+        capacity_(std::max<std::size_t>(
+            byte_budget / (tile_size * tile_size * sizeof(T)), 1)),
+        fd_(::open(path.c_str(), O_RDONLY)) {
+    if (fd_ == -1) {
+      throw std::system_error(errno, std::generic_category(), path.string());
+    }
+
+    struct stat stat;
+    if (::fstat(fd_, &stat) == -1) {
+      const auto error = errno;
+      ::close(fd_);
+      throw std::system_error(error, std::generic_category(), path.string());
+    }
+    if (static_cast<std::size_t>(stat.st_size) <
+        file_size(rows, columns, tile_size)) {
+      ::close(fd_);
+      throw std::length_error(path.string() + " is smaller than the matrix");
+    }
+    tiles_.reserve(capacity_);
+  }
+
+  tile_cache(const tile_cache&) = delete;
+  tile_cache& operator=(const tile_cache&) = delete;
+
+  ~tile_cache() {
+    for (const auto& entry : lru_) {
+      ::munmap(entry.address, entry.length);
+    }
+    ::close(fd_);
+  }
+
+ public:
+  /*
+   * Bytes taken by a tiled file of a matrix of the given size
+   */
+  static constexpr std::size_t file_size(std::size_t rows, std::size_t columns,
+                                         std::size_t tile_size) noexcept {
+    return (rows + tile_size - 1) / tile_size *
+           ((columns + tile_size - 1) / tile_size) * tile_size * tile_size *
+           sizeof(T);
+  }
+
+  std::ptrdiff_t tile_size() const noexcept { return tile_size_; }
+  std::size_t capacity() const noexcept { return capacity_; }
+  const tile_cache_stats& stats() const noexcept { return stats_; }
+
+  /*
+   * Elements of the tile in row-major order. Maps the tile on a miss and
+   * evicts the least recently used one if the cache is full. The returned
+   * pointer is valid until the tile is evicted
+   */
+  const T* tile(std::ptrdiff_t tile_row, std::ptrdiff_t tile_column) {
+    const auto tile = tile_row * tile_columns_ + tile_column;
+    if (const auto it = tiles_.find(tile); it != tiles_.end()) {
+      ++stats_.hits;
+      lru_.splice(lru_.begin(), lru_, it->second);
+      return data(*it->second);
+    }
+
+    ++stats_.misses;
+    auto mapped = map(tile);
+    if (lru_.size() == capacity_) {
+      ++stats_.evictions;
+      tiles_.erase(lru_.back().tile);
+      ::munmap(lru_.back().address, lru_.back().length);
+      lru_.splice(lru_.begin(), lru_, std::prev(lru_.end()));
+      lru_.front() = mapped;
+    } else {
+      lru_.push_front(mapped);
+    }
+    tiles_.emplace(tile, lru_.begin());
+    return data(lru_.front());
+  }
+
+  /*
+   * Asks the kernel to start reading a tile that is about to be accessed
+   * unless it is resident or outside of the tile grid
+   */
+  void prefetch(std::ptrdiff_t tile_row, std::ptrdiff_t tile_column) noexcept {
+    if (tile_row < 0 || tile_row >= tile_rows_ || tile_column < 0 ||
+        tile_column >= tile_columns_) {
+      return;
+    }
+    const auto tile = tile_row * tile_columns_ + tile_column;
+    if (!tiles_.contains(tile)) {
+      ++stats_.prefetches;
+      ::posix_fadvise(fd_, offset(tile), tile_bytes(), POSIX_FADV_WILLNEED);
+    }
+  }
+
+ private:
+  off_t tile_bytes() const noexcept {
+    return static_cast<off_t>(tile_size_ * tile_size_) *
+           static_cast<off_t>(sizeof(T));
+  }
+  off_t offset(std::ptrdiff_t tile) const noexcept {
+    return static_cast<off_t>(tile) * tile_bytes();
+  }
+
+  /*
+   * Maps the pages that hold the tile. Tiles start at multiples of the tile
+   * size rather than of the page size, so the mapping may start before it
+   */
+  entry map(std::ptrdiff_t tile) const {
+    const auto page = static_cast<off_t>(::sysconf(_SC_PAGESIZE));
+    const auto start = offset(tile) / page * page;
+    const auto length =
+        static_cast<std::size_t>(offset(tile) - start + tile_bytes());
+    const auto address = ::mmap(nullptr, length, PROT_READ,
+                                MAP_PRIVATE, fd_, start);
+    if (address == MAP_FAILED) {
+      throw std::system_error(errno, std::generic_category());
+    }
+    return entry{tile, address, length};
+  }
+
+  const T* data(const entry& entry) const noexcept {
+    const auto page = static_cast<off_t>(::sysconf(_SC_PAGESIZE));
+    return reinterpret_cast<const T*>(static_cast<const char*>(entry.address) +
+                                      offset(entry.tile) % page);
+  }
+
+ private:
+  std::ptrdiff_t tile_size_;
+  std::ptrdiff_t tile_rows_;
+  std::ptrdiff_t tile_columns_;
+  std::size_t capacity_;
+
+  int fd_;
+
+  std::list<entry> lru_;
+  std::unordered_map<std::ptrdiff_t, typename std::list<entry>::iterator>
+      tiles_;
+
+  tile_cache_stats stats_;
+};
+
+}  // namespace matrix_views::storage
@@ -0,0 +1,214 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "storage/tile_cache.hpp"
+#include "utils/index.hpp"
+#include "utils/tags.hpp"
+
+namespace matrix_views::storage {
+
+/*
+ * Read-only storage proxy over a matrix stored tile by tile in a file and
+ * accessed through a tile_cache
+ *
+ * Every copy of the proxy remembers the tile it accessed last, so iterators
+ * look the cache up only when they cross into another tile. On such a
+ * crossing the proxy also prefetches the next tile in the same direction,
+ * i.e. the direction of the iterator that owns the proxy
+ *
+ * Iterators read through a cursor on the part of their stripe in the resident
+ * tile and locate the index only once they leave it
+ *
+ * The proxy does not own the tile. It reads the elements in place as long as
+ * the cache evicted nothing since the lookup and looks the tile up again
+ * otherwise. That keeps the proxy trivially copyable, so iterators stay in
+ * registers
+ */
+template <typename T>
+class tiled_storage_proxy {
+ public:
+  tiled_storage_proxy() noexcept = default;
+  tiled_storage_proxy(tile_cache<T>* cache) noexcept
+      : cache_(cache),
+        tile_size_(static_cast<std::size_t>(cache->tile_size())) {}
+
+ public:
+  using reference = T;
+  using value_type = T;
+
+  reference operator()(utils::index index) const { return *locate(index); }
+
+  /*
+   * Element at the index, read through the cursor of the direction of the
+   * tag. Moves the cursor to the tile of the index if it is outside of it
+   */
+  template <typename Tag>
+  reference at(Tag, utils::index index) const {
+    auto offset = position(Tag{}, index) - cursor_.first;
+    if (static_cast<std::size_t>(offset) >= cursor_.size ||
+        resident_.evictions != cache_->stats().evictions) [[unlikely]] {
+      cursor_ = seek(Tag{}, index);
+      offset = position(Tag{}, index) - cursor_.first;
+    }
+    return cursor_.data[offset * cursor_.stride];
+  }
+
+  /*
+   * Maximal run of elements adjacent in memory among the size elements from
+   * the index in the direction of the tag, i.e. up to the end of the tile for
+   * rows and a single element otherwise. The span is valid until the cache
+   * evicts a tile, i.e. until the matrix is accessed at another tile
+   */
+  std::span<const T> segment(utils::kRowTag, utils::index index,
+                             std::ptrdiff_t size) const {
+    const auto* data = locate(index);
+    const auto left = static_cast<std::ptrdiff_t>(tile_size_) -
+                      (index.column - resident_.tile.column);
+    return std::span<const T>(data,
+                              static_cast<std::size_t>(std::min(size, left)));
+  }
+  template <typename Tag>
+  std::span<const T> segment(Tag, utils::index index, std::ptrdiff_t) const {
+    return std::span<const T>(locate(index), 1);
+  }
+
+ private:
+  /*
+   * Elements of a tile as of a number of evictions from the cache
+   */
+  struct resident final {
+    const T* data = nullptr;
+    utils::index tile = kNoTile;
+    std::size_t evictions = 0;
+  };
+
+  /*
+   * Elements of a tile that lie on one stripe in the direction of a tag, by
+   * the index component that changes along the stripe
+   */
+  struct cursor final {
+    const T* data = nullptr;
+    std::ptrdiff_t stride = 0;
+    std::ptrdiff_t first = 0;
+    std::size_t size = 0;
+  };
+
+  template <typename Tag>
+  static std::ptrdiff_t position(Tag, utils::index index) noexcept {
+    if constexpr (std::is_same_v<Tag, utils::kRowTag>) {
+      return index.column;
+    } else {
+      return index.row;
+    }
+  }
+
+  const T* locate(utils::index index) const {
+    auto row = static_cast<std::size_t>(index.row - resident_.tile.row);
+    auto column = static_cast<std::size_t>(index.column - resident_.tile.column);
+    if (row >= tile_size_ || column >= tile_size_ ||
+        resident_.evictions != cache_->stats().evictions) [[unlikely]] {
+      resident_ = load(cache_, index, resident_.tile);
+      if (resident_.data == nullptr) [[unlikely]] {
+        rethrow();
+      }
+      // The load may have evicted the tile of the cursor
+      cursor_ = cursor();
+      row = static_cast<std::size_t>(index.row - resident_.tile.row);
+      column = static_cast<std::size_t>(index.column - resident_.tile.column);
+    }
+    return resident_.data + row * tile_size_ + column;
+  }
+
+  template <typename Tag>
+  cursor seek(Tag, utils::index index) const {
+    const auto* data = locate(index);
+    const auto tile_size = static_cast<std::ptrdiff_t>(tile_size_);
+    const auto row = index.row - resident_.tile.row;
+    const auto column = index.column - resident_.tile.column;
+    const auto make = [&](std::ptrdiff_t stride, std::ptrdiff_t before,
+                          std::ptrdiff_t after) {
+      return cursor{data - before * stride, stride,
+                    position(Tag{}, index) - before,
+                    static_cast<std::size_t>(before + after)};
+    };
+    if constexpr (std::is_same_v<Tag, utils::kRowTag>) {
+      return make(1, column, tile_size - column);
+    } else if constexpr (std::is_same_v<Tag, utils::kColumnTag>) {
+      return make(tile_size, row, tile_size - row);
+    } else if constexpr (std::is_same_v<Tag, utils::kDiagonalTag>) {
+      return make(tile_size + 1, std::min(row, column),
+                  tile_size - std::max(row, column));
+    } else {
+      static_assert(std::is_same_v<Tag, utils::kAntidiagonalTag>);
+      return make(tile_size - 1, std::min(row, tile_size - 1 - column),
+                  std::min(tile_size - row, column + 1));
+    }
+  }
+
+  /*
+   * Kept out of line and away from the proxy, so that the loops of iterators
+   * stay tight and keep the proxy in registers. Does not throw, since a call
+   * that may unwind out of a loop makes GCC keep the values of the loop that
+   * live across it in memory. Returns no elements on failure and leaves the
+   * exception to rethrow
+   */
+  [[gnu::cold, gnu::noinline]] static resident load(
+      tile_cache<T>* cache, utils::index index,
+      utils::index previous) noexcept {
+    const auto tile_size = cache->tile_size();
+    const auto tile = utils::index{index.row / tile_size * tile_size,
+                                   index.column / tile_size * tile_size};
+    const T* data = nullptr;
+    try {
+      data = cache->tile(tile.row / tile_size, tile.column / tile_size);
+    } catch (...) {
+      failure() = std::current_exception();
+      return {};
+    }
+
+    if (previous != kNoTile && previous != tile) {
+      const auto step_row =
+          (tile.row > previous.row) - (tile.row < previous.row);
+      const auto step_column =
+          (tile.column > previous.column) - (tile.column < previous.column);
+      cache->prefetch(tile.row / tile_size + step_row,
+                      tile.column / tile_size + step_column);
+    }
+    return {data, tile, cache->stats().evictions};
+  }
+
+  [[noreturn, gnu::cold, gnu::noinline]] static void rethrow() {
+    std::rethrow_exception(std::exchange(failure(), nullptr));
+  }
+
+  /*
+   * Exception of the last failed load on this thread
+   */
+  static std::exception_ptr& failure() noexcept {
+    thread_local std::exception_ptr failure;
+    return failure;
+  }
+
+ private:
+  /*
+   * Origin of no tile, so that the first access to any cell loads its tile
+   */
+  static constexpr utils::index kNoTile = {
+      std::numeric_limits<std::ptrdiff_t>::min() / 2,
+      std::numeric_limits<std::ptrdiff_t>::min() / 2};
+
+  tile_cache<T>* cache_ = nullptr;
+  std::size_t tile_size_ = 0;
+
+  mutable resident resident_;
+  mutable cursor cursor_;
+};
+
+}  // namespace matrix_views::storage
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <concepts>
+#include <type_traits>
+#include <utility>
+
+#include "utils/index.hpp"
+#include "utils/tags.hpp"
+
+namespace matrix_views::storage {
+
+/*
+ * Storage proxy that accesses the cells of another one with the row and the
+ * column of the index swapped
+ */
+template <typename StorageProxy>
+  requires std::invocable<const StorageProxy, utils::index>
+class transposed_storage_proxy {
+ public:
+  constexpr transposed_storage_proxy() = default;
+  constexpr transposed_storage_proxy(StorageProxy storage_proxy)
+      : storage_proxy_(std::move(storage_proxy)) {}
+
+ public:
+  using reference = std::invoke_result_t<const StorageProxy, utils::index>;
+  using value_type = std::remove_cvref_t<reference>;
+
+  constexpr reference operator()(utils::index index) const {
+    return storage_proxy_({index.column, index.row});
+  }
+
+  /*
+   * Segments of the rows, columns and diagonals of the proxy, if it has
+   * them, as the segments of the columns, rows and diagonals of this one
+   */
+  constexpr auto segment(utils::kRowTag, utils::index index,
+                         std::ptrdiff_t size) const
+    requires requires(const StorageProxy storage_proxy) {
+      storage_proxy.segment(utils::kColumn, index, size);
+    }
+  {
+    return storage_proxy_.segment(utils::kColumn, {index.column, index.row},
+                                  size);
+  }
+  constexpr auto segment(utils::kColumnTag, utils::index index,
+                         std::ptrdiff_t size) const
+    requires requires(const StorageProxy storage_proxy) {
+      storage_proxy.segment(utils::kRow, index, size);
+    }
+  {
+    return storage_proxy_.segment(utils::kRow, {index.column, index.row},
+                                  size);
+  }
+  constexpr auto segment(utils::kDiagonalTag, utils::index index,
+                         std::ptrdiff_t size) const
+    requires requires(const StorageProxy storage_proxy) {
+      storage_proxy.segment(utils::kDiagonal, index, size);
+    }
+  {
+    return storage_proxy_.segment(utils::kDiagonal, {index.column, index.row},
+                                  size);
+  }
+
+  /*
+   * Transposing twice gives back the original proxy
+   */
+  constexpr StorageProxy transposed() const { return storage_proxy_; }
+
+ private:
+  StorageProxy storage_proxy_;
+};
+
+/*
+ * Storage proxy of the transposed matrix. Uses the transposed() member of the
+ * proxy if it has one, e.g. strided_storage_proxy swaps its strides, and
+ * wraps the proxy into transposed_storage_proxy otherwise
+ */
+template <typename StorageProxy>
+  requires std::invocable<const StorageProxy, utils::index>
+constexpr decltype(auto) transposed(const StorageProxy& storage_proxy) {
+  if constexpr (requires { storage_proxy.transposed(); }) {
+    return storage_proxy.transposed();
+  } else {
+    return transposed_storage_proxy<StorageProxy>(storage_proxy);
+  }
+}
+
+}  // namespace matrix_views::storage
@@ -0,0 +1,371 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "utils/index.hpp"
+#include "utils/tags.hpp"
+
+/*
+ * Compile-time switch of the access instrumentation. Instrumented storage
+ * proxies compile to the proxies they wrap unless it is set to 1
+ */
+#if !defined(MATRIX_VIEWS_INSTRUMENTATION)
+#define MATRIX_VIEWS_INSTRUMENTATION 0
+#endif
+
+namespace matrix_views::utils {
+
+inline constexpr bool kInstrumentation = MATRIX_VIEWS_INSTRUMENTATION != 0;
+
+/*
+ * Counters of the storage accesses of a traversal. Every access is classified
+ * by the move from the previous access of the same thread: along a row,
+ * column, diagonal or antidiagonal, or any other jump
+ */
+class access_profile final {
+ public:
+  /*
+   * Number of buckets of the stride histogram. Bucket 0 counts repeated
+   * accesses to the same cell and bucket b > 0 the moves of [2^(b-1), 2^b)
+   * cells, the last bucket taking all longer moves
+   */
+  static inline const constinit std::size_t kStrideBuckets = 16;
+
+ public:
+  constexpr std::uint64_t accesses() const noexcept { return accesses_; }
+
+  /*
+   * Accesses that moved along the direction of the tag, and all others
+   */
+  constexpr std::uint64_t moves(kRowTag) const noexcept { return moves_[0]; }
+  constexpr std::uint64_t moves(kColumnTag) const noexcept {
+    return moves_[1];
+  }
+  constexpr std::uint64_t moves(kDiagonalTag) const noexcept {
+    return moves_[2];
+  }
+  constexpr std::uint64_t moves(kAntidiagonalTag) const noexcept {
+    return moves_[3];
+  }
+  constexpr std::uint64_t jumps() const noexcept { return moves_[4]; }
+
+  /*
+   * Accesses that moved along the direction of the tag per stripe, keyed by
+   * the row, the column, or the diagonal and antidiagonal numbers as used by
+   * matrix::diagonal and matrix::antidiagonal
+   */
+  const std::map<std::ptrdiff_t, std::uint64_t>& stripes(
+      kRowTag) const noexcept {
+    return stripes_[0];
+  }
+  const std::map<std::ptrdiff_t, std::uint64_t>& stripes(
+      kColumnTag) const noexcept {
+    return stripes_[1];
+  }
+  const std::map<std::ptrdiff_t, std::uint64_t>& stripes(
+      kDiagonalTag) const noexcept {
+    return stripes_[2];
+  }
+  const std::map<std::ptrdiff_t, std::uint64_t>& stripes(
+      kAntidiagonalTag) const noexcept {
+    return stripes_[3];
+  }
+
+  /*
+   * Histogram of the Chebyshev distance between consecutive accesses
+   */
+  constexpr const std::array<std::uint64_t, kStrideBuckets>& strides()
+      const noexcept {
+    return strides_;
+  }
+
+  /*
+   * Timestamp counter ticks spent in timed accesses
+   */
+  constexpr std::uint64_t ticks() const noexcept { return ticks_; }
+
+  void merge(const access_profile& that) {
+    accesses_ += that.accesses_;
+    ticks_ += that.ticks_;
+    for (std::size_t i = 0; i < moves_.size(); ++i) {
+      moves_[i] += that.moves_[i];
+    }
+    for (std::size_t i = 0; i < stripes_.size(); ++i) {
+      for (const auto& [stripe, count] : that.stripes_[i]) {
+        stripes_[i][stripe] += count;
+      }
+    }
+    for (std::size_t i = 0; i < kStrideBuckets; ++i) {
+      strides_[i] += that.strides_[i];
+    }
+  }
+
+ private:
+  template <typename Site>
+  friend class access_profiler;
+
+  std::uint64_t accesses_ = 0;
+  std::uint64_t ticks_ = 0;
+  std::array<std::uint64_t, 5> moves_{};
+  std::array<std::map<std::ptrdiff_t, std::uint64_t>, 4> stripes_;
+  std::array<std::uint64_t, kStrideBuckets> strides_{};
+};
+
+/*
+ * Collects the access profile of a site, i.e. of all storage proxies
+ * instrumented with the same Site type. Every thread counts into its own
+ * counters, which are summed into the result on collect() and into the
+ * retired profile when the thread exits
+ *
+ * Only the owning thread writes its counters, so an access costs relaxed
+ * atomic loads and stores and no lock. collect() reads the counters of
+ * running threads as they are and reset() is exact only while no thread
+ * accesses the site. Stripes are counted in flat arrays allocated in blocks
+ * on first use, by stripe numbers of magnitude under kMaxStripes. Moves
+ * along other stripes are counted in the directions only
+ */
+template <typename Site = void>
+class access_profiler final {
+ public:
+  static inline const constinit std::ptrdiff_t kMaxStripes = 1 << 19;
+
+ private:
+  using counter = std::atomic<std::uint64_t>;
+
+  /*
+   * Counters of the stripes in one direction. Stripe k takes the slot 2k if
+   * it is nonnegative and -2k - 1 otherwise, so diagonals below the main one
+   * share the array
+   */
+  class stripe_counters final {
+   public:
+    static inline const constinit std::size_t kBlockSize = 4096;
+    static inline const constinit std::size_t kBlocks =
+        2 * kMaxStripes / kBlockSize;
+
+    stripe_counters() = default;
+    stripe_counters(const stripe_counters&) = delete;
+    stripe_counters& operator=(const stripe_counters&) = delete;
+    ~stripe_counters() {
+      for (auto& block : blocks_) {
+        delete[] block.load(std::memory_order_relaxed);
+      }
+    }
+
+    void increment(std::ptrdiff_t stripe) {
+      if (stripe <= -kMaxStripes || stripe >= kMaxStripes) {
+        return;
+      }
+      const auto slot = static_cast<std::size_t>(
+          stripe >= 0 ? 2 * stripe : -2 * stripe - 1);
+      auto& block = blocks_[slot / kBlockSize];
+      auto* counters = block.load(std::memory_order_relaxed);
+      if (counters == nullptr) [[unlikely]] {
+        counters = new counter[kBlockSize]();
+        block.store(counters, std::memory_order_release);
+      }
+      access_profiler::increment(counters[slot % kBlockSize]);
+    }
+
+    void collect(std::map<std::ptrdiff_t, std::uint64_t>& result) const {
+      for (std::size_t i = 0; i < kBlocks; ++i) {
+        const auto* counters = blocks_[i].load(std::memory_order_acquire);
+        if (counters == nullptr) {
+          continue;
+        }
+        for (std::size_t j = 0; j < kBlockSize; ++j) {
+          const auto count = counters[j].load(std::memory_order_relaxed);
+          if (count != 0) {
+            const auto slot = static_cast<std::ptrdiff_t>(i * kBlockSize + j);
+            result[slot % 2 == 0 ? slot / 2 : -(slot + 1) / 2] += count;
+          }
+        }
+      }
+    }
+
+    void reset() noexcept {
+      for (auto& block : blocks_) {
+        if (auto* counters = block.load(std::memory_order_acquire)) {
+          for (std::size_t j = 0; j < kBlockSize; ++j) {
+            counters[j].store(0, std::memory_order_relaxed);
+          }
+        }
+      }
+    }
+
+   private:
+    std::array<std::atomic<counter*>, kBlocks> blocks_{};
+  };
+
+  struct thread_profile;
+
+  struct shared_state final {
+    std::mutex mutex;
+    std::vector<thread_profile*> threads;
+    access_profile retired;
+  };
+
+  struct thread_profile final {
+    counter accesses{0};
+    counter ticks{0};
+    std::array<counter, 5> moves{};
+    std::array<stripe_counters, 4> stripes;
+    std::array<counter, access_profile::kStrideBuckets> strides{};
+
+    index previous = {0, 0};
+    std::atomic<bool> started{false};
+
+    thread_profile() {
+      auto& shared = access_profiler::shared();
+      const std::lock_guard lock(shared.mutex);
+      shared.threads.push_back(this);
+    }
+
+    ~thread_profile() {
+      auto& shared = access_profiler::shared();
+      const std::lock_guard lock(shared.mutex);
+      std::erase(shared.threads, this);
+      shared.retired.merge(snapshot());
+    }
+
+    access_profile snapshot() const {
+      auto result = access_profile();
+      result.accesses_ = accesses.load(std::memory_order_relaxed);
+      result.ticks_ = ticks.load(std::memory_order_relaxed);
+      for (std::size_t i = 0; i < moves.size(); ++i) {
+        result.moves_[i] = moves[i].load(std::memory_order_relaxed);
+      }
+      for (std::size_t i = 0; i < stripes.size(); ++i) {
+        stripes[i].collect(result.stripes_[i]);
+      }
+      for (std::size_t i = 0; i < strides.size(); ++i) {
+        result.strides_[i] = strides[i].load(std::memory_order_relaxed);
+      }
+      return result;
+    }
+
+    void reset() noexcept {
+      for (auto* counter : {&accesses, &ticks}) {
+        counter->store(0, std::memory_order_relaxed);
+      }
+      for (auto& counter : moves) {
+        counter.store(0, std::memory_order_relaxed);
+      }
+      for (auto& counters : stripes) {
+        counters.reset();
+      }
+      for (auto& counter : strides) {
+        counter.store(0, std::memory_order_relaxed);
+      }
+      started.store(false, std::memory_order_relaxed);
+    }
+  };
+
+ public:
+  /*
+   * Counts an access at the index that follows the previous access of the
+   * thread. Every access is classified by the move from that access
+   */
+  static void record(index index, std::uint64_t ticks = 0) {
+    auto& local = thread_local_profile();
+    increment(local.accesses);
+    increment(local.ticks, ticks);
+    const auto previous = local.previous;
+    local.previous = index;
+    if (!local.started.load(std::memory_order_relaxed)) {
+      local.started.store(true, std::memory_order_relaxed);
+      return;
+    }
+
+    const auto rows = index.row - previous.row;
+    const auto columns = index.column - previous.column;
+    const auto distance = static_cast<std::uint64_t>(
+        std::max(std::abs(rows), std::abs(columns)));
+    increment(local.strides[std::min<std::size_t>(
+        std::bit_width(distance), access_profile::kStrideBuckets - 1)]);
+
+    if (rows == 0 && columns != 0) {
+      increment(local.moves[0]), local.stripes[0].increment(index.row);
+    } else if (columns == 0 && rows != 0) {
+      increment(local.moves[1]), local.stripes[1].increment(index.column);
+    } else if (rows == columns && rows != 0) {
+      increment(local.moves[2]);
+      local.stripes[2].increment(index.column - index.row);
+    } else if (rows == -columns && rows != 0) {
+      increment(local.moves[3]);
+      local.stripes[3].increment(index.row + index.column);
+    } else {
+      increment(local.moves[4]);
+    }
+  }
+
+  /*
+   * Profile merged over all threads that ever accessed the site
+   */
+  static access_profile collect() {
+    auto& shared = access_profiler::shared();
+    const std::lock_guard lock(shared.mutex);
+    auto result = shared.retired;
+    for (const auto* thread : shared.threads) {
+      result.merge(thread->snapshot());
+    }
+    return result;
+  }
+
+  static void reset() {
+    auto& shared = access_profiler::shared();
+    const std::lock_guard lock(shared.mutex);
+    shared.retired = access_profile();
+    for (auto* thread : shared.threads) {
+      thread->reset();
+    }
+  }
+
+  /*
+   * Timestamp counter where available and steady clock nanoseconds otherwise
+   */
+  static std::uint64_t ticks() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return static_cast<std::uint64_t>(
+        std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+  }
+
+ private:
+  /*
+   * Only the owning thread writes the counter, so it needs no atomic
+   * read-modify-write
+   */
+  static void increment(counter& counter, std::uint64_t n = 1) noexcept {
+    counter.store(counter.load(std::memory_order_relaxed) + n,
+                  std::memory_order_relaxed);
+  }
+
+  static shared_state& shared() {
+    static shared_state instance;
+    return instance;
+  }
+
+  static thread_profile& thread_local_profile() {
+    thread_local thread_profile instance;
+    return instance;
+  }
+};
+
+}  // namespace matrix_views::utils
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+
+namespace matrix_views::utils {
+
+/*
+ * Size of a cache line assumed for alignment of the owned storage
+ */
+inline constexpr std::size_t kCacheLineSize = 64;
+
+/*
+ * Minimal allocator that aligns every allocation to Alignment bytes
+ */
+template <typename T, std::size_t Alignment = kCacheLineSize>
+class aligned_allocator {
+  static_assert(Alignment >= alignof(T) && (Alignment & (Alignment - 1)) == 0,
+                "alignment must be a power of two not less than alignof(T)");
+
+ public:
+  using value_type = T;
+
+  template <typename U>
+  struct rebind {
+    using other = aligned_allocator<U, Alignment>;
+  };
+
+  constexpr aligned_allocator() noexcept = default;
+  template <typename U>
+  constexpr aligned_allocator(
+      const aligned_allocator<U, Alignment>&) noexcept {}
+
+ public:
+  [[nodiscard]] T* allocate(std::size_t n) {
+    return static_cast<T*>(
+        ::operator new(n * sizeof(T), std::align_val_t(Alignment)));
+  }
+
+  void deallocate(T* p, std::size_t) noexcept {
+    ::operator delete(p, std::align_val_t(Alignment));
+  }
+
+  template <typename U>
+  constexpr bool operator==(
+      const aligned_allocator<U, Alignment>&) const noexcept {
+    return true;
+  }
+};
+
+}  // namespace matrix_views::utils
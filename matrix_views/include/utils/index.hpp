@@ -1,17 +1,73 @@
 #pragma once
 
+#include <algorithm>
+#include <concepts>
 #include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <utility>
 
 namespace matrix_views::utils {
 
 /*
- * 2-dimensional index
+ * Concept representing the set of valid integer types of index components
+ */
+template <typename Int>
+concept index_integral =
+    std::integral<Int> && !std::same_as<std::remove_cv_t<Int>, bool>;
+
+namespace detail {
+
+/*
+ * Whether every value of the From type is a value of the To type
+ */
+template <typename From, typename To>
+inline constexpr bool kWidening =
+    std::cmp_less_equal(std::numeric_limits<To>::min(),
+                        std::numeric_limits<From>::min()) &&
+    std::cmp_greater_equal(std::numeric_limits<To>::max(),
+                           std::numeric_limits<From>::max());
+
+}  // namespace detail
+
+/*
+ * 2-dimensional index with components of the given integer type. Converts
+ * implicitly to an index of a wider component type, e.g. narrow iterator
+ * indices widen to index to access the storage. Conversions that may narrow
+ * are explicit and wrap like static_cast
  */
-struct index final {
-  std::ptrdiff_t row;
-  std::ptrdiff_t column;
+template <index_integral Int>
+struct basic_index final {
+  Int row;
+  Int column;
 
-  constexpr bool operator==(const index& that) const = default;
+  constexpr bool operator==(const basic_index& that) const = default;
+
+  template <index_integral That>
+    requires(!std::same_as<Int, That>)
+  constexpr explicit(!detail::kWidening<Int, That>)
+  operator basic_index<That>() const noexcept {
+    return {static_cast<That>(row), static_cast<That>(column)};
+  }
 };
 
+/*
+ * 2-dimensional index
+ */
+using index = basic_index<std::ptrdiff_t>;
+
+/*
+ * Index component type of the ranges over a matrix of the given dimensions.
+ * Matrices that store dimensions under 2^31 in the type get 32-bit indices,
+ * so the indices of their iterators take half the space
+ */
+template <std::size_t Rows, std::size_t Columns>
+using default_index_t = std::conditional_t<
+    Rows != std::dynamic_extent && Columns != std::dynamic_extent &&
+        std::max(Rows, Columns) <
+            static_cast<std::size_t>(std::numeric_limits<std::int32_t>::max()),
+    std::int32_t, std::ptrdiff_t>;
+
 }  // namespace matrix_views::utils
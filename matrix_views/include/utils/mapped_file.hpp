@@ -0,0 +1,112 @@
+#pragma once
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <filesystem>
+#include <system_error>
+#include <utility>
+
+namespace matrix_views::utils {
+
+/*
+ * Access pattern hint for the pages of a mapped file
+ */
+enum class mapped_file_advice {
+  kNormal = MADV_NORMAL,
+  kSequential = MADV_SEQUENTIAL,
+  kRandom = MADV_RANDOM,
+};
+
+/*
+ * Owning shared memory mapping of a whole file, either read-only or
+ * read-write. Mapping is O(1) in the size of the file as pages are loaded on
+ * first access. Throws std::system_error if the file cannot be mapped
+ */
+class mapped_file final {
+ public:
+  mapped_file() noexcept = default;
+  mapped_file(const std::filesystem::path& path, bool writable) {
+    const int fd = ::open(path.c_str(), writable ? O_RDWR : O_RDONLY);
+    if (fd == -1) {
+      throw std::system_error(errno, std::generic_category(), path.string());
+    }
+
+    struct stat stat;
+    if (::fstat(fd, &stat) == -1) {
+      const auto error = errno;
+      ::close(fd);
+      throw std::system_error(error, std::generic_category(), path.string());
+    }
+    size_ = static_cast<std::size_t>(stat.st_size);
+
+    if (size_ != 0) {
+      data_ = ::mmap(nullptr, size_,
+                     writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED,
+                     fd, 0);
+    }
+    const auto error = errno;
+    ::close(fd);
+    if (data_ == MAP_FAILED) {
+      data_ = nullptr;
+      throw std::system_error(error, std::generic_category(), path.string());
+    }
+  }
+
+  mapped_file(const mapped_file&) = delete;
+  mapped_file& operator=(const mapped_file&) = delete;
+
+  mapped_file(mapped_file&& that) noexcept
+      : data_(std::exchange(that.data_, nullptr)),
+        size_(std::exchange(that.size_, 0)) {}
+  mapped_file& operator=(mapped_file&& that) noexcept {
+    if (this != &that) {
+      unmap();
+      data_ = std::exchange(that.data_, nullptr);
+      size_ = std::exchange(that.size_, 0);
+    }
+    return *this;
+  }
+
+  ~mapped_file() { unmap(); }
+
+ public:
+  void* data() const noexcept { return data_; }
+  std::size_t size() const noexcept { return size_; }
+
+  /*
+   * Hints the kernel how the pages are about to be accessed. The hint is
+   * advisory, so failures are ignored
+   */
+  void advise(mapped_file_advice advice) const noexcept {
+    if (data_ != nullptr) {
+      ::madvise(data_, size_, static_cast<int>(advice));
+    }
+  }
+
+  /*
+   * Writes the modified pages back to the file
+   */
+  void flush() const {
+    if (data_ != nullptr && ::msync(data_, size_, MS_SYNC) == -1) {
+      throw std::system_error(errno, std::generic_category());
+    }
+  }
+
+ private:
+  void unmap() noexcept {
+    if (data_ != nullptr) {
+      ::munmap(data_, size_);
+    }
+  }
+
+ private:
+  void* data_ = nullptr;
+  std::size_t size_ = 0;
+};
+
+}  // namespace matrix_views::utils
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <concepts>
+#include <memory>
+#include <optional>
+#include <utility>
+
+namespace matrix_views::utils {
+
+/*
+ * Wrapper that makes a copy constructible type T default constructible and
+ * copy assignable. Provides uniform access to the wrapped value via
+ * operator*(). Accessing a default constructed box is undefined unless T is
+ * semiregular
+ *
+ * Semiregular types are stored as is. Trivially copy constructible and
+ * destructible types, such as lambdas capturing pointers, are stored in an
+ * untagged union. Other types fall back to std::optional
+ */
+template <std::copy_constructible T, bool IsSemiregular = std::semiregular<T>,
+          bool IsTriviallyCopyable = std::is_trivially_copy_constructible_v<T> &&
+                                     std::is_trivially_destructible_v<T>>
+class semiregular_box;
+
+template <std::copy_constructible T, bool IsTriviallyCopyable>
+class semiregular_box<T, true, IsTriviallyCopyable> final {
+ public:
+  constexpr semiregular_box() noexcept(
+      std::is_nothrow_default_constructible_v<T>) = default;
+  constexpr semiregular_box(T value) noexcept(
+      std::is_nothrow_move_constructible_v<T>)
+      : value_(std::move(value)) {}
+
+ public:
+  constexpr T& operator*() noexcept { return value_; }
+  constexpr const T& operator*() const noexcept { return value_; }
+
+ private:
+  [[no_unique_address]] T value_{};
+};
+
+template <std::copy_constructible T>
+class semiregular_box<T, false, true> final {
+ public:
+  constexpr semiregular_box() noexcept = default;
+  constexpr semiregular_box(T value) noexcept : storage_(std::move(value)) {}
+
+  constexpr semiregular_box(const semiregular_box& that) noexcept = default;
+  constexpr semiregular_box& operator=(const semiregular_box& that) noexcept {
+    std::construct_at(std::addressof(storage_), that.storage_);
+    return *this;
+  }
+
+ public:
+  constexpr T& operator*() noexcept { return storage_.value; }
+  constexpr const T& operator*() const noexcept { return storage_.value; }
+
+ private:
+  union storage {
+    constexpr storage() noexcept : empty() {}
+    constexpr storage(T value) noexcept : value(std::move(value)) {}
+
+    char empty;
+    T value;
+  } storage_;
+};
+
+template <std::copy_constructible T>
+class semiregular_box<T, false, false> final {
+ public:
+  constexpr semiregular_box() noexcept = default;
+  constexpr semiregular_box(T value) noexcept(
+      std::is_nothrow_move_constructible_v<T>)
+      : value_(std::move(value)) {}
+
+  constexpr semiregular_box(const semiregular_box& that) = default;
+  constexpr semiregular_box& operator=(const semiregular_box& that) {
+    if (this != std::addressof(that)) {
+      that.value_ ? void(value_.emplace(*that.value_)) : value_.reset();
+    }
+    return *this;
+  }
+
+  constexpr semiregular_box(semiregular_box&& that) = default;
+  constexpr semiregular_box& operator=(semiregular_box&& that) {
+    that.value_ ? void(value_.emplace(std::move(*that.value_)))
+                : value_.reset();
+    return *this;
+  }
+
+ public:
+  constexpr T& operator*() noexcept { return *value_; }
+  constexpr const T& operator*() const noexcept { return *value_; }
+
+ private:
+  std::optional<T> value_;
+};
+
+}  // namespace matrix_views::utils
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+#include "utils/index.hpp"
+
+namespace matrix_views::utils {
+
+namespace detail {
+
+inline constexpr std::uint64_t kEvenBits = 0x5555555555555555;
+
+/*
+ * Moves the lower 32 bits of the value to the even bits of the result. Uses
+ * PDEP where available
+ */
+constexpr std::uint64_t spread_bits(std::uint64_t value) noexcept {
+#if defined(__BMI2__)
+  if (!std::is_constant_evaluated()) {
+    return _pdep_u64(value, kEvenBits);
+  }
+#endif
+  value &= 0x00000000ffffffff;
+  value = (value | (value << 16)) & 0x0000ffff0000ffff;
+  value = (value | (value << 8)) & 0x00ff00ff00ff00ff;
+  value = (value | (value << 4)) & 0x0f0f0f0f0f0f0f0f;
+  value = (value | (value << 2)) & 0x3333333333333333;
+  value = (value | (value << 1)) & kEvenBits;
+  return value;
+}
+
+/*
+ * Moves the even bits of the value to the lower 32 bits of the result. Uses
+ * PEXT where available
+ */
+constexpr std::uint64_t compact_bits(std::uint64_t value) noexcept {
+#if defined(__BMI2__)
+  if (!std::is_constant_evaluated()) {
+    return _pext_u64(value, kEvenBits);
+  }
+#endif
+  value &= kEvenBits;
+  value = (value | (value >> 1)) & 0x3333333333333333;
+  value = (value | (value >> 2)) & 0x0f0f0f0f0f0f0f0f;
+  value = (value | (value >> 4)) & 0x00ff00ff00ff00ff;
+  value = (value | (value >> 8)) & 0x0000ffff0000ffff;
+  value = (value | (value >> 16)) & 0x00000000ffffffff;
+  return value;
+}
+
+}  // namespace detail
+
+/*
+ * Position of the cell in Z-order. Columns take the even bits and rows the
+ * odd ones, so the curve visits the top left, top right, bottom left and
+ * bottom right quadrant of every aligned square in turn
+ */
+constexpr std::uint64_t morton_encode(index index) noexcept {
+  return detail::spread_bits(static_cast<std::uint64_t>(index.column)) |
+         detail::spread_bits(static_cast<std::uint64_t>(index.row)) << 1;
+}
+
+constexpr index morton_decode(std::uint64_t position) noexcept {
+  return {static_cast<std::ptrdiff_t>(detail::compact_bits(position >> 1)),
+          static_cast<std::ptrdiff_t>(detail::compact_bits(position))};
+}
+
+/*
+ * Smallest order of a curve over the aligned square of side 2^order that
+ * covers a rows x columns matrix
+ */
+constexpr int curve_order(std::size_t rows, std::size_t columns) noexcept {
+  const auto side = std::max(rows, columns);
+  return side == 0 ? 0 : static_cast<int>(std::bit_width(side - 1));
+}
+
+namespace detail {
+
+/*
+ * Reflects a quadrant of side size so that the curve through it starts and
+ * ends at the right corners
+ */
+constexpr void hilbert_rotate(std::ptrdiff_t size, std::ptrdiff_t& row,
+                              std::ptrdiff_t& column, std::ptrdiff_t row_bit,
+                              std::ptrdiff_t column_bit) noexcept {
+  if (column_bit == 0) {
+    if (row_bit == 1) {
+      row = size - 1 - row;
+      column = size - 1 - column;
+    }
+    std::swap(row, column);
+  }
+}
+
+}  // namespace detail
+
+/*
+ * Position of the cell along the Hilbert curve of the given order. The curve
+ * visits the top left, top right, bottom right and bottom left quadrant of
+ * every aligned square in turn
+ */
+constexpr std::uint64_t hilbert_encode(index index, int order) noexcept {
+  auto row = index.row;
+  auto column = index.column;
+
+  std::uint64_t position = 0;
+  for (std::ptrdiff_t size = std::ptrdiff_t(1) << order >> 1; size > 0;
+       size /= 2) {
+    const std::ptrdiff_t row_bit = (row & size) != 0;
+    const std::ptrdiff_t column_bit = (column & size) != 0;
+    position += static_cast<std::uint64_t>(size) *
+                static_cast<std::uint64_t>(size) *
+                static_cast<std::uint64_t>((3 * row_bit) ^ column_bit);
+    detail::hilbert_rotate(std::ptrdiff_t(1) << order, row, column, row_bit,
+                           column_bit);
+  }
+  return position;
+}
+
+constexpr index hilbert_decode(std::uint64_t position, int order) noexcept {
+  std::ptrdiff_t row = 0;
+  std::ptrdiff_t column = 0;
+  for (std::ptrdiff_t size = 1; size < std::ptrdiff_t(1) << order; size *= 2) {
+    const auto row_bit = static_cast<std::ptrdiff_t>(1 & (position / 2));
+    const auto column_bit =
+        static_cast<std::ptrdiff_t>(1 & (position ^ (position / 2)));
+    detail::hilbert_rotate(size, row, column, row_bit, column_bit);
+    row += size * row_bit;
+    column += size * column_bit;
+    position /= 4;
+  }
+  return {row, column};
+}
+
+}  // namespace matrix_views::utils
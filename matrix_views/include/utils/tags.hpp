@@ -28,6 +28,51 @@ constexpr struct kDiagonalTag final {
 constexpr struct kAntidiagonalTag final {
 } kAntidiagonal;
 
+/*
+ * Tile tag. Represents square blocks of a matrix ordered from the top left
+ * corner block by block, left to right and then top to bottom
+ */
+constexpr struct kTileTag final {
+} kTile;
+
+/*
+ * Morton tag. Represents all cells of a matrix in Z-order, i.e. ordered by
+ * the interleaved bits of their rows and columns
+ */
+constexpr struct kMortonTag final {
+} kMorton;
+
+/*
+ * Hilbert tag. Represents all cells of a matrix along the Hilbert curve,
+ * which moves to an adjacent cell at every step
+ */
+constexpr struct kHilbertTag final {
+} kHilbert;
+
+/*
+ * Upper triangle tag. Represents the cells on and above the main diagonal
+ */
+constexpr struct kUpperTag final {
+} kUpper;
+
+/*
+ * Lower triangle tag. Represents the cells on and below the main diagonal
+ */
+constexpr struct kLowerTag final {
+} kLower;
+
+/*
+ * Row-major layout tag. Elements of a row are adjacent in memory
+ */
+constexpr struct kRowMajorTag final {
+} kRowMajor;
+
+/*
+ * Column-major layout tag. Elements of a column are adjacent in memory
+ */
+constexpr struct kColumnMajorTag final {
+} kColumnMajor;
+
 /*
  * Tag representing some value known at compile time
  */
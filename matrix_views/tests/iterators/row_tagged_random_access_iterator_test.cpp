@@ -8,13 +8,14 @@ namespace tests {
 using namespace matrix_views::iterators;
 using namespace matrix_views::storage;
 using namespace matrix_views::utils;
+using matrix_views::utils::index;
 
 namespace {
 
 auto kTag = kRow;
 auto kEchoIndex = index{};
 auto kEchoStorageProxy = const_callable_storage_proxy(
-    [](index index) -> index& { return kEchoIndex = index; });
+    [](index idx) -> index& { return kEchoIndex = idx; });
 
 using mock_tagged_random_access_iterator_t =
     tagged_random_access_iterator<decltype(kTag), decltype(kEchoStorageProxy)>;
@@ -0,0 +1,95 @@
+#include "iterators/stripe_random_access_iterator.hpp"
+
+#include <gtest/gtest.h>
+
+#include "storage/const_callable_storage_proxy.hpp"
+
+namespace tests {
+
+using namespace matrix_views::iterators;
+using namespace matrix_views::storage;
+using namespace matrix_views::utils;
+using matrix_views::utils::index;
+
+namespace {
+
+auto kEchoIndex = index{};
+auto kEchoStorageProxy = const_callable_storage_proxy(
+    [](index idx) -> index& { return kEchoIndex = idx; });
+
+template <typename Tag>
+using mock_stripe_random_access_iterator_t =
+    stripe_random_access_iterator<Tag, decltype(kEchoStorageProxy), 3, 4>;
+
+}  // namespace
+
+TEST(stripe_random_access_iterator, enforce_concept) {
+  static_assert(std::random_access_iterator<
+                mock_stripe_random_access_iterator_t<kRowTag>>);
+  static_assert(std::random_access_iterator<
+                stripe_random_access_iterator<kDiagonalTag,
+                                              decltype(kEchoStorageProxy)>>);
+}
+
+TEST(stripe_random_access_iterator, sizeof) {
+  static_assert(sizeof(mock_stripe_random_access_iterator_t<kColumnTag>) ==
+                sizeof(index));
+}
+
+TEST(stripe_random_access_iterator, row) {
+  auto it =
+      mock_stripe_random_access_iterator_t<kRowTag>(kRow, {1, 0},
+                                                    kEchoStorageProxy);
+
+  EXPECT_EQ(*(*it).begin(), (index{1, 0}));
+  EXPECT_EQ(std::size(*it), 4);
+  EXPECT_EQ(*it[1].begin(), (index{2, 0}));
+  EXPECT_EQ(*(*--it).begin(), (index{0, 0}));
+}
+
+TEST(stripe_random_access_iterator, column) {
+  auto it =
+      mock_stripe_random_access_iterator_t<kColumnTag>(kColumn, {0, 1},
+                                                       kEchoStorageProxy);
+
+  EXPECT_EQ(*(*it).begin(), (index{0, 1}));
+  EXPECT_EQ(std::size(*it), 3);
+  EXPECT_EQ(*(*++it).begin(), (index{0, 2}));
+}
+
+TEST(stripe_random_access_iterator, diagonal) {
+  const auto it = mock_stripe_random_access_iterator_t<kDiagonalTag>(
+      kDiagonal, {0, -2}, kEchoStorageProxy);
+
+  EXPECT_EQ(*(*it).begin(), (index{2, 0}));
+  EXPECT_EQ(std::size(*it), 1);
+  EXPECT_EQ(*it[2].begin(), (index{0, 0}));
+  EXPECT_EQ(std::size(it[2]), 3);
+  EXPECT_EQ(*it[5].begin(), (index{0, 3}));
+  EXPECT_EQ(std::size(it[5]), 1);
+}
+
+TEST(stripe_random_access_iterator, antidiagonal) {
+  const auto it = mock_stripe_random_access_iterator_t<kAntidiagonalTag>(
+      kAntidiagonal, {0, 0}, kEchoStorageProxy);
+
+  EXPECT_EQ(*(*it).begin(), (index{0, 0}));
+  EXPECT_EQ(std::size(*it), 1);
+  EXPECT_EQ(*it[3].begin(), (index{0, 3}));
+  EXPECT_EQ(std::size(it[3]), 3);
+  EXPECT_EQ(*it[5].begin(), (index{2, 3}));
+  EXPECT_EQ(std::size(it[5]), 1);
+}
+
+TEST(stripe_random_access_iterator, distance_and_comparison) {
+  const auto it1 = mock_stripe_random_access_iterator_t<kAntidiagonalTag>(
+      kAntidiagonal, {0, 0}, kEchoStorageProxy);
+  const auto it2 = it1 + 4;
+
+  EXPECT_EQ(it2 - it1, 4);
+  EXPECT_EQ(it1 - it2, -4);
+  EXPECT_LT(it1, it2);
+  EXPECT_EQ(it2 - 4, it1);
+}
+
+}  // namespace tests
@@ -0,0 +1,75 @@
+#include "iterators/tile_random_access_iterator.hpp"
+
+#include <gtest/gtest.h>
+
+#include "storage/const_callable_storage_proxy.hpp"
+
+namespace tests {
+
+using namespace matrix_views::iterators;
+using namespace matrix_views::storage;
+using namespace matrix_views::utils;
+using matrix_views::utils::index;
+
+namespace {
+
+auto kEchoIndex = index{};
+auto kEchoStorageProxy = const_callable_storage_proxy(
+    [](index idx) -> index& { return kEchoIndex = idx; });
+
+// 5 x 7 matrix split into a 2 x 3 grid of tiles of size 3
+using mock_tile_random_access_iterator_t =
+    tile_random_access_iterator<decltype(kEchoStorageProxy), 3, 5, 7>;
+
+}  // namespace
+
+TEST(tile_random_access_iterator, enforce_concept) {
+  static_assert(
+      std::random_access_iterator<mock_tile_random_access_iterator_t>);
+  static_assert(std::random_access_iterator<
+                tile_random_access_iterator<decltype(kEchoStorageProxy)>>);
+}
+
+TEST(tile_random_access_iterator, sizeof) {
+  static_assert(sizeof(mock_tile_random_access_iterator_t) == sizeof(index));
+}
+
+TEST(tile_random_access_iterator, dereference) {
+  const auto it =
+      mock_tile_random_access_iterator_t(kTile, {0, 0}, kEchoStorageProxy);
+
+  EXPECT_EQ((*it)({0, 0}), (index{0, 0}));
+  EXPECT_EQ((*it).rows(), 3);
+  EXPECT_EQ((*it).columns(), 3);
+
+  EXPECT_EQ(it[2]({0, 0}), (index{0, 6}));
+  EXPECT_EQ(it[2].rows(), 3);
+  EXPECT_EQ(it[2].columns(), 1);
+
+  EXPECT_EQ(it[3]({0, 0}), (index{3, 0}));
+  EXPECT_EQ(it[3].rows(), 2);
+  EXPECT_EQ(it[3].columns(), 3);
+}
+
+TEST(tile_random_access_iterator, movement) {
+  auto it =
+      mock_tile_random_access_iterator_t(kTile, {0, 2}, kEchoStorageProxy);
+
+  EXPECT_EQ((*++it)({0, 0}), (index{3, 0}));
+  EXPECT_EQ((*--it)({0, 0}), (index{0, 6}));
+  EXPECT_EQ((*(it + 2))({0, 0}), (index{3, 3}));
+  EXPECT_EQ((*(it - 2))({0, 0}), (index{0, 0}));
+}
+
+TEST(tile_random_access_iterator, distance_and_comparison) {
+  const auto it1 =
+      mock_tile_random_access_iterator_t(kTile, {0, 1}, kEchoStorageProxy);
+  const auto it2 = it1 + 5;
+
+  EXPECT_EQ(it2 - it1, 5);
+  EXPECT_EQ(it1 - it2, -5);
+  EXPECT_LT(it1, it2);
+  EXPECT_EQ(it2 - 5, it1);
+}
+
+}  // namespace tests
@@ -0,0 +1,126 @@
+#include "kernels/fixed_size.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <numeric>
+
+#include "matrices/matrix.hpp"
+#include "matrices/matrix_view.hpp"
+#include "ranges/tagged_random_access_range.hpp"
+
+namespace tests {
+
+using namespace matrix_views::kernels;
+using namespace matrix_views::matrices;
+using namespace matrix_views::ranges;
+using namespace matrix_views::utils;
+using matrix_views::utils::index;
+
+namespace {
+
+template <typename Matrix>
+Matrix make_matrix(std::initializer_list<double> values) {
+  auto m = Matrix();
+  std::ranges::copy(values, m.data());
+  return m;
+}
+
+}  // namespace
+
+TEST(kernels, static_size) {
+  using matrix_t = matrix<int, 3, 4>;
+  static_assert(kStaticSizeOf<decltype(matrix_t().row(0))> == 4);
+  static_assert(kStaticSizeOf<decltype(matrix_t().column(0))> == 3);
+  static_assert(kStaticSizeOf<decltype(matrix_t().diagonal(0))> ==
+                std::dynamic_extent);
+  static_assert(kStaticSizeOf<decltype(matrix<int>().row(0))> ==
+                std::dynamic_extent);
+
+  static_assert(fixed_size_matrix<matrix_t&>);
+  static_assert(fixed_size_matrix<matrix_t>);
+  static_assert(fixed_size_matrix<decltype(submatrix<2, 2>(
+                    std::declval<matrix_t&>(), {}))>);
+  static_assert(!fixed_size_matrix<matrix<int>&>);
+  static_assert(!fixed_size_square_matrix<matrix_t&>);
+}
+
+TEST(kernels, fixed_size_multiply) {
+  auto lhs = matrix<int, 2, 3>();
+  auto rhs = matrix<int, 3, 2, kColumnMajorTag>();
+  std::iota(lhs.data(), lhs.data() + lhs.size(), 1);
+  std::iota(rhs.data(), rhs.data() + rhs.size(), 1);
+
+  auto product = matrix<int, 2, 2>();
+  multiply(lhs, rhs, product);
+  EXPECT_TRUE(std::ranges::equal(product.row(0), std::array{14, 32}));
+  EXPECT_TRUE(std::ranges::equal(product.row(1), std::array{32, 77}));
+
+  // The destination may alias an operand and be a view
+  auto square = matrix<int, 3, 3>();
+  std::iota(square.data(), square.data() + square.size(), 0);
+  multiply(square, transpose(square), square);
+  EXPECT_TRUE(std::ranges::equal(square.row(0), std::array{5, 14, 23}));
+  EXPECT_TRUE(std::ranges::equal(square.row(2), std::array{23, 86, 149}));
+
+  multiply(submatrix<2, 2>(square, {0, 0}), product,
+           submatrix<2, 2>(square, {1, 1}));
+  EXPECT_TRUE(std::ranges::equal(square.row(1), std::array{14, 518, 1238}));
+  EXPECT_TRUE(std::ranges::equal(square.row(2), std::array{23, 1796, 4298}));
+}
+
+TEST(kernels, fixed_size_determinant) {
+  EXPECT_EQ(determinant(make_matrix<matrix<double, 1, 1>>({-2})), -2);
+  EXPECT_EQ(determinant(make_matrix<matrix<double, 2, 2>>({1, 2, 3, 4})), -2);
+  EXPECT_EQ(determinant(make_matrix<matrix<double, 3, 3>>(
+                {2, 0, 1, 1, 3, 2, 1, 1, 2})),
+            6);
+  EXPECT_EQ(determinant(make_matrix<matrix<double, 4, 4>>(
+                {1, 0, 2, -1, 3, 0, 0, 5, 2, 1, 4, -3, 1, 0, 5, 0})),
+            30);
+  EXPECT_EQ(determinant(make_matrix<matrix<double, 3, 3>>(
+                {1, 2, 3, 4, 5, 6, 7, 8, 9})),
+            0);
+}
+
+TEST(kernels, fixed_size_inverse) {
+  const auto m = make_matrix<matrix<double, 4, 4>>(
+      {1, 0, 2, -1, 3, 0, 0, 5, 2, 1, 4, -3, 1, 0, 5, 0});
+
+  auto inverted = matrix<double, 4, 4>();
+  ASSERT_TRUE(inverse(m, inverted));
+
+  auto identity = matrix<double, 4, 4>();
+  multiply(m, inverted, identity);
+  for (std::ptrdiff_t i = 0; i < 4; ++i) {
+    for (std::ptrdiff_t j = 0; j < 4; ++j) {
+      EXPECT_NEAR(identity({i, j}), i == j ? 1. : 0., 1e-12);
+    }
+  }
+
+  auto two = make_matrix<matrix<double, 2, 2>>({4, 2, 1, 1});
+  ASSERT_TRUE(inverse(two, two));
+  EXPECT_TRUE(std::ranges::equal(two.row(0), std::array{0.5, -1.}));
+  EXPECT_TRUE(std::ranges::equal(two.row(1), std::array{-0.5, 2.}));
+
+  auto singular = make_matrix<matrix<double, 2, 2>>({1, 2, 2, 4});
+  EXPECT_FALSE(inverse(singular, singular));
+  EXPECT_TRUE(std::ranges::equal(singular.row(1), std::array{2., 4.}));
+}
+
+TEST(kernels, fixed_size_reduce) {
+  auto m = matrix<int, 3, 4>();
+  std::iota(m.data(), m.data() + m.size(), 0);
+
+  EXPECT_EQ(reduce(kRow, m), (std::array{6, 22, 38}));
+  EXPECT_EQ(reduce(kColumn, m), (std::array{12, 15, 18, 21}));
+  EXPECT_EQ(reduce(kRow, transpose(m), std::multiplies<>()),
+            (std::array{0, 45, 120, 231}));
+  EXPECT_EQ(reduce(kColumn, submatrix<2, 2>(m, {1, 1}),
+                   [](int lhs, int rhs) { return std::max(lhs, rhs); }),
+            (std::array{9, 10}));
+}
+
+}  // namespace tests
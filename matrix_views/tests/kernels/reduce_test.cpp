@@ -0,0 +1,114 @@
+#include "kernels/reduce.hpp"
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <ranges>
+#include <vector>
+
+#include "matrices/matrix.hpp"
+#include "ranges/tagged_random_access_range.hpp"
+#include "storage/const_callable_storage_proxy.hpp"
+
+namespace tests {
+
+using namespace matrix_views::kernels;
+using namespace matrix_views::matrices;
+using namespace matrix_views::ranges;
+using namespace matrix_views::storage;
+using namespace matrix_views::utils;
+using matrix_views::utils::index;
+
+namespace {
+
+// 37 x 41 matrix whose element values are 41 * row + column
+matrix<int, 37, 41> make_matrix() {
+  auto m = matrix<int, 37, 41>();
+  std::iota(m.data(), m.data() + m.size(), 0);
+  return m;
+}
+
+auto kRowColumnStorageProxy = const_callable_storage_proxy(
+    [](index index) { return static_cast<int>(index.row + index.column); });
+
+}  // namespace
+
+TEST(kernels, enforce_concept) {
+  using matrix_t = matrix<float>;
+  static_assert(contiguous_kernel_range<decltype(matrix_t().row(0))>);
+  static_assert(!contiguous_kernel_range<decltype(matrix_t().column(0))>);
+  static_assert(strided_kernel_range<decltype(matrix_t().column(0))>);
+  static_assert(strided_kernel_range<decltype(matrix_t().antidiagonal(0))>);
+  static_assert(strided_kernel_range<std::vector<float>>);
+  static_assert(!strided_kernel_range<tagged_random_access_range<
+                    kRowTag, decltype(kRowColumnStorageProxy)>>);
+}
+
+TEST(kernels, sum) {
+  const auto m = make_matrix();
+
+  for (std::ptrdiff_t i = 0; i < 37; ++i) {
+    EXPECT_EQ(sum(m.row(i)), std::accumulate(m.row(i).begin(),
+                                             m.row(i).end(), 0));
+  }
+  for (std::ptrdiff_t j = 0; j < 41; ++j) {
+    EXPECT_EQ(sum(m.column(j)), std::accumulate(m.column(j).begin(),
+                                                m.column(j).end(), 0));
+  }
+  EXPECT_EQ(sum(m.antidiagonal(40)),
+            std::accumulate(m.antidiagonal(40).begin(),
+                            m.antidiagonal(40).end(), 0));
+  EXPECT_EQ(sum(m.diagonal(-36)), 36 * 41);
+  EXPECT_EQ(sum(std::vector<float>{0.5f, 1.5f, 2.f}), 4.f);
+  EXPECT_EQ(sum(std::vector<int>()), 0);
+
+  const auto generic = tagged_random_access_range<kRowTag,
+                                                  decltype(kRowColumnStorageProxy),
+                                                  3, 4>(kRow, {2, 0},
+                                                        kRowColumnStorageProxy);
+  EXPECT_EQ(sum(generic), 2 + 3 + 4 + 5);
+}
+
+TEST(kernels, dot) {
+  const auto m = make_matrix();
+
+  EXPECT_EQ(dot(m.row(3), m.row(5)),
+            std::inner_product(m.row(3).begin(), m.row(3).end(),
+                               m.row(5).begin(), 0));
+  EXPECT_EQ(dot(m.column(1), m.diagonal(0)),
+            std::inner_product(m.diagonal(0).begin(), m.diagonal(0).end(),
+                               m.column(1).begin(), 0));
+  EXPECT_EQ(dot(m.column(2), m.column(7)),
+            std::inner_product(m.column(2).begin(), m.column(2).end(),
+                               m.column(7).begin(), 0));
+  EXPECT_EQ(dot(std::vector<float>{1.f, 2.f}, std::vector<double>{3., 4.}),
+            11.);
+
+  // Both ranges must have the same size
+  EXPECT_DEATH(dot(m.row(1), m.diagonal(0)), "");
+  EXPECT_DEATH(dot(m.row(1), m.row(1) | std::views::take(3)), "");
+  EXPECT_DEATH(dot(std::vector<int>{1}, std::vector<int>{1, 2}), "");
+}
+
+TEST(kernels, minmax) {
+  auto m = make_matrix();
+  m({20, 3}) = -1;
+  m({30, 3}) = 10000;
+
+  const auto [column_min, column_max] = minmax(m.column(3));
+  EXPECT_EQ(column_min, -1);
+  EXPECT_EQ(column_max, 10000);
+
+  const auto [row_min, row_max] = minmax(m.row(20));
+  EXPECT_EQ(row_min, -1);
+  EXPECT_EQ(row_max, 20 * 41 + 40);
+
+  const auto generic = tagged_random_access_range<kColumnTag,
+                                                  decltype(kRowColumnStorageProxy),
+                                                  3, 4>(kColumn, {0, 1},
+                                                        kRowColumnStorageProxy);
+  EXPECT_EQ(minmax(generic).min, 1);
+  EXPECT_EQ(minmax(generic).max, 3);
+}
+
+}  // namespace tests
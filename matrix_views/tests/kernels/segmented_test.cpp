@@ -0,0 +1,200 @@
+#include "kernels/segmented.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "matrices/matrix.hpp"
+#include "matrices/tiled_matrix.hpp"
+#include "ranges/tagged_random_access_range.hpp"
+#include "storage/callable_storage_proxy.hpp"
+#include "storage/shifted_storage_proxy.hpp"
+#include "storage/strided_storage_proxy.hpp"
+#include "storage/transposed_storage_proxy.hpp"
+
+namespace tests {
+
+using namespace matrix_views::kernels;
+using namespace matrix_views::matrices;
+using namespace matrix_views::ranges;
+using namespace matrix_views::storage;
+using namespace matrix_views::utils;
+using matrix_views::utils::index;
+
+namespace {
+
+// 5x7 matrix with the value of every element equal to 10 * row + column
+matrix<int> make_matrix() {
+  auto m = matrix<int>(5, 7);
+  for (std::ptrdiff_t i = 0; i < 5; ++i) {
+    for (std::ptrdiff_t j = 0; j < 7; ++j) {
+      m({i, j}) = static_cast<int>(10 * i + j);
+    }
+  }
+  return m;
+}
+
+// Tiled file of make_matrix() with 3x3 tiles, removed on destruction
+class matrix_file final {
+ public:
+  matrix_file()
+      : path_(std::filesystem::temp_directory_path() /
+              ("segmented_test_" +
+               std::string(::testing::UnitTest::GetInstance()
+                               ->current_test_info()
+                               ->name()))) {
+    tiled_matrix<int>::store(path_, make_matrix(), 3);
+  }
+  ~matrix_file() { std::filesystem::remove(path_); }
+
+  const std::filesystem::path& path() const noexcept { return path_; }
+
+ private:
+  std::filesystem::path path_;
+};
+
+template <typename Range>
+std::vector<std::size_t> segment_sizes(const Range& range) {
+  auto result = std::vector<std::size_t>();
+  for_each_segment(range, [&](auto segment) {
+    result.push_back(segment.size());
+  });
+  return result;
+}
+
+// Writable range that reports its elements as read-only segments
+struct read_only_segments final {
+  std::deque<int>* elements;
+
+  auto begin() const { return elements->begin(); }
+  auto end() const { return elements->end(); }
+  std::span<const int> segment(std::ptrdiff_t n) const {
+    return std::span<const int>(&(*elements)[static_cast<std::size_t>(n)], 1);
+  }
+};
+
+template <typename Source, typename Destination>
+concept copyable = requires(Source&& source, Destination&& destination) {
+  copy(std::forward<Source>(source), std::forward<Destination>(destination));
+};
+
+}  // namespace
+
+TEST(segmented, enforce_concept) {
+  static_assert(segmented_kernel_range<decltype(matrix<int>().row(0))>);
+  static_assert(segmented_kernel_range<decltype(matrix<int>().diagonal(0))>);
+  static_assert(segmented_kernel_range<std::vector<int>&>);
+  static_assert(
+      !segmented_kernel_range<decltype(stride(matrix<int>().row(0), 2))>);
+  static_assert(segmented_kernel_range<
+                decltype(std::declval<tiled_matrix<int>>().column(0))>);
+}
+
+TEST(segmented, strided_segments) {
+  const auto m = make_matrix();
+  EXPECT_EQ(segment_sizes(m.row(2)), (std::vector<std::size_t>{7}));
+  EXPECT_EQ(segment_sizes(m.column(2)), (std::vector<std::size_t>(5, 1)));
+
+  // Strides only known at runtime
+  const auto column_major = tagged_random_access_range(
+      kColumn, index{0, 1},
+      strided_storage_proxy<const int>(m.data(), 1, 5), 5, 7);
+  EXPECT_EQ(segment_sizes(column_major), (std::vector<std::size_t>{5}));
+}
+
+TEST(segmented, tiled_segments) {
+  const auto file = matrix_file();
+  const auto m = tiled_matrix<int>(file.path(), 5, 7, 3, 1 << 12);
+
+  EXPECT_EQ(segment_sizes(m.row(4)), (std::vector<std::size_t>{3, 3, 1}));
+  EXPECT_EQ(segment_sizes(tagged_random_access_range(
+                kRow, index{1, 2}, m.storage(), 5, 7)),
+            (std::vector<std::size_t>{1, 3, 1}));
+  EXPECT_EQ(segment_sizes(m.column(1)), (std::vector<std::size_t>(5, 1)));
+
+  auto values = std::vector<int>();
+  for_each_segment(m.row(3), [&](auto segment) {
+    values.insert(values.end(), segment.begin(), segment.end());
+  });
+  EXPECT_EQ(values, (std::vector<int>{30, 31, 32, 33, 34, 35, 36}));
+
+  // Columns of the transposed storage are its rows
+  const auto transposed_range = tagged_random_access_range(
+      kColumn, index{0, 3}, transposed_storage_proxy(m.storage()), 7, 5);
+  EXPECT_EQ(segment_sizes(transposed_range),
+            (std::vector<std::size_t>{3, 3, 1}));
+
+  // Shifted proxies report the segments at the shifted index
+  const auto shifted_range = tagged_random_access_range(
+      kRow, index{0, 0}, shifted(m.storage(), {2, 1}), 3, 6);
+  EXPECT_EQ(segment_sizes(shifted_range), (std::vector<std::size_t>{2, 3, 1}));
+}
+
+TEST(segmented, copy) {
+  const auto file = matrix_file();
+  const auto tiled = tiled_matrix<int>(file.path(), 5, 7, 3, 1 << 12);
+  auto m = matrix<int>(7, 7);
+
+  copy(tiled.row(2), m.row(0));
+  EXPECT_TRUE(std::ranges::equal(m.row(0), tiled.row(2)));
+
+  copy(tiled.row(4), m.column(6));
+  EXPECT_TRUE(std::ranges::equal(m.column(6), tiled.row(4)));
+
+  copy(tiled.column(5), m.diagonal(0));
+  EXPECT_TRUE(
+      std::ranges::equal(std::views::take(m.diagonal(0), 5), tiled.column(5)));
+
+  auto values = std::vector<int>(5);
+  copy(make_matrix().column(3), values);
+  EXPECT_EQ(values, (std::vector<int>{3, 13, 23, 33, 43}));
+
+  // Destinations with read-only segments are written through the iterators
+  auto elements = std::deque<int>(7);
+  copy(tiled.row(1), read_only_segments{&elements});
+  EXPECT_TRUE(std::ranges::equal(elements, tiled.row(1)));
+
+  // Tiled ranges are read-only
+  static_assert(!copyable<std::vector<int>&, decltype(tiled.row(0))>);
+  static_assert(copyable<decltype(tiled.row(0)), std::vector<int>&>);
+}
+
+TEST(segmented, reduce) {
+  const auto file = matrix_file();
+  const auto tiled = tiled_matrix<int>(file.path(), 5, 7, 3, 1 << 12);
+  const auto m = make_matrix();
+
+  EXPECT_EQ(reduce(tiled.row(2), 0), 7 * 20 + 21);
+  EXPECT_EQ(reduce(m.row(2), 0), 7 * 20 + 21);
+  EXPECT_EQ(reduce(m.column(6), 0L), 100 + 30);
+  EXPECT_EQ(reduce(tiled.column(0), 1, std::multiplies<>()), 0);
+  EXPECT_EQ(reduce(tiled.row(4), 0, [](int lhs, int rhs) {
+              return std::max(lhs, rhs);
+            }),
+            46);
+  EXPECT_EQ(reduce(tagged_random_access_range(kRow, index{0, 7}, m.storage(),
+                                              5, 7),
+                   5),
+            5);
+
+  auto values = std::vector<double>(100);
+  std::iota(values.begin(), values.end(), 1.);
+  EXPECT_EQ(reduce(values, 0.), 5050.);
+
+  const auto callable = tagged_random_access_range(
+      kRow, index{0, 0},
+      callable_storage_proxy([](index index) { return index.column; }), 1,
+      40);
+  EXPECT_EQ(reduce(callable, std::ptrdiff_t(0)), 780);
+}
+
+}  // namespace tests
@@ -0,0 +1,70 @@
+#include "kernels/transform.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <vector>
+
+#include "matrices/matrix.hpp"
+#include "ranges/tagged_random_access_range.hpp"
+#include "storage/callable_storage_proxy.hpp"
+
+namespace tests {
+
+using namespace matrix_views::kernels;
+using namespace matrix_views::matrices;
+using namespace matrix_views::ranges;
+using namespace matrix_views::storage;
+using namespace matrix_views::utils;
+using matrix_views::utils::index;
+
+namespace {
+
+constexpr auto kTwiceAndOne = [](auto value) { return 2 * value + 1; };
+
+}  // namespace
+
+TEST(kernels, transform) {
+  auto m = matrix<int>(19, 23);
+  std::iota(m.data(), m.data() + m.size(), 0);
+
+  auto expected = std::vector<int>(m.row(4).begin(), m.row(4).end());
+  std::ranges::transform(expected, expected.begin(), kTwiceAndOne);
+  transform(m.row(4), m.row(4), kTwiceAndOne);
+  EXPECT_TRUE(std::ranges::equal(m.row(4), expected));
+
+  expected.assign(m.column(3).begin(), m.column(3).end());
+  std::ranges::transform(expected, expected.begin(), kTwiceAndOne);
+  transform(m.column(3), m.column(5), kTwiceAndOne);
+  EXPECT_TRUE(std::ranges::equal(m.column(5), expected));
+
+  auto floats = std::vector<float>(19);
+  transform(m.column(5), floats, [](int value) { return value / 2.f; });
+  EXPECT_EQ(floats[18], (2 * (18 * 23 + 3) + 1) / 2.f);
+}
+
+TEST(kernels, fill) {
+  auto m = matrix<double, 5, 7>();
+  fill(m.row(1), 1);
+  fill(m.column(6), 2.);
+  fill(m.diagonal(0), 3.);
+
+  EXPECT_TRUE(
+      std::ranges::equal(m.row(1), std::array{1., 3., 1., 1., 1., 1., 2.}));
+  EXPECT_EQ(m({4, 6}), 2.);
+  EXPECT_EQ(m({4, 4}), 3.);
+
+  auto values = std::array<int, 4>();
+  const auto storage_proxy = callable_storage_proxy(
+      [data = values.data()](index index) -> int& {
+        return data[index.column];
+      });
+  fill(tagged_random_access_range<kRowTag, decltype(storage_proxy), 1, 4>(
+           kRow, {0, 1}, storage_proxy),
+       5);
+  EXPECT_EQ(values, (std::array{0, 5, 5, 5}));
+}
+
+}  // namespace tests
@@ -0,0 +1,156 @@
+#include "kernels/transpose.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <numeric>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "matrices/matrix.hpp"
+#include "matrices/matrix_view.hpp"
+#include "storage/callable_storage_proxy.hpp"
+#include "storage/shifted_storage_proxy.hpp"
+
+namespace tests {
+
+using namespace matrix_views::kernels;
+using namespace matrix_views::matrices;
+using namespace matrix_views::storage;
+using namespace matrix_views::utils;
+using matrix_views::utils::index;
+
+namespace {
+
+template <typename T, typename Layout = kRowMajorTag>
+matrix<T, std::dynamic_extent, std::dynamic_extent, Layout> make_matrix(
+    std::size_t rows, std::size_t columns) {
+  auto m =
+      matrix<T, std::dynamic_extent, std::dynamic_extent, Layout>(rows,
+                                                                  columns);
+  std::iota(m.data(), m.data() + m.size(), T());
+  return m;
+}
+
+template <typename Source, typename Destination>
+bool is_transpose(const Source& source, const Destination& destination) {
+  if (source.rows() != destination.columns() ||
+      source.columns() != destination.rows()) {
+    return false;
+  }
+  for (std::ptrdiff_t i = 0; i < std::ssize(source.column(0)); ++i) {
+    for (std::ptrdiff_t j = 0; j < std::ssize(source.row(0)); ++j) {
+      if (source({i, j}) != destination({j, i})) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+template <typename T>
+void expect_dense_transpose() {
+  // Odd sizes leave edges outside of the micro-kernels
+  for (const auto& [rows, columns] :
+       std::vector<std::pair<std::size_t, std::size_t>>{
+           {1, 1}, {8, 8}, {67, 45}, {45, 67}, {130, 9}}) {
+    const auto source = make_matrix<T>(rows, columns);
+    auto destination = matrix<T>(columns, rows);
+    transpose(source, destination);
+    EXPECT_TRUE(is_transpose(source, destination)) << rows << "x" << columns;
+  }
+}
+
+template <typename Matrix>
+concept in_place_transposable =
+    requires(Matrix&& matrix) { transpose_in_place(matrix); };
+
+}  // namespace
+
+TEST(kernels, transpose_dense) {
+  expect_dense_transpose<float>();
+  expect_dense_transpose<double>();
+  expect_dense_transpose<std::int32_t>();
+  expect_dense_transpose<std::int16_t>();
+}
+
+TEST(kernels, transpose_strided) {
+  const auto source = make_matrix<double>(70, 41);
+  auto destination =
+      matrix<double, std::dynamic_extent, std::dynamic_extent, kColumnMajorTag>(
+          41, 70);
+  transpose(source, destination);
+  EXPECT_TRUE(is_transpose(source, destination));
+
+  auto back = matrix<double>(70, 41);
+  transpose(destination, back);
+  EXPECT_TRUE(std::equal(back.data(), back.data() + back.size(),
+                         source.data()));
+}
+
+TEST(kernels, transpose_cells) {
+  const auto source = matrix_view(
+      callable_storage_proxy(
+          [](index index) { return 1000 * index.row + index.column; }),
+      50, 37);
+  auto destination = matrix<std::ptrdiff_t>(37, 50);
+  transpose(source, destination);
+  EXPECT_TRUE(is_transpose(source, destination));
+}
+
+TEST(kernels, transpose_checks_destination) {
+  const auto source = make_matrix<int>(3, 5);
+  auto same = matrix<int>(3, 5);
+  auto longer = matrix<int>(5, 4);
+  EXPECT_DEATH(transpose(source, same), "");
+  EXPECT_DEATH(transpose(source, longer), "");
+}
+
+TEST(kernels, transpose_in_place_square) {
+  const auto original = make_matrix<int>(75, 75);
+  auto m = original;
+  transpose_in_place(m);
+  EXPECT_TRUE(is_transpose(original, m));
+
+  // Square part of a larger matrix
+  auto n = make_matrix<int>(50, 60);
+  transpose_in_place(matrix_view(shifted(n.storage(), {5, 12}), 40, 40));
+  for (std::ptrdiff_t i = 0; i < 50; ++i) {
+    for (std::ptrdiff_t j = 0; j < 60; ++j) {
+      const auto inside = i >= 5 && i < 45 && j >= 12 && j < 52;
+      const auto expected = inside ? (j - 12 + 5) * 60 + (i - 5 + 12)
+                                   : static_cast<std::ptrdiff_t>(i * 60 + j);
+      EXPECT_EQ(n({i, j}), expected) << i << ", " << j;
+    }
+  }
+}
+
+TEST(kernels, transpose_in_place_rejects_rectangular) {
+  static_assert(in_place_transposable<matrix<int, 3, 3>&>);
+  static_assert(!in_place_transposable<matrix<int, 2, 3>&>);
+  static_assert(in_place_transposable<matrix<int, 2>&>);
+
+  auto m = make_matrix<int>(2, 3);
+  EXPECT_DEATH(transpose_in_place(m), "");
+}
+
+TEST(kernels, transpose_in_place_rectangular) {
+  for (const auto& [rows, columns] :
+       std::vector<std::pair<std::size_t, std::size_t>>{
+           {13, 7}, {7, 13}, {1, 9}, {64, 3}, {40, 40}}) {
+    const auto original = make_matrix<int>(rows, columns);
+    auto values = std::vector<int>(original.data(),
+                                   original.data() + original.size());
+    transpose_in_place(std::span(values), rows, columns);
+
+    auto transposed = matrix<int>(columns, rows);
+    std::copy(values.begin(), values.end(), transposed.data());
+    EXPECT_TRUE(is_transpose(original, transposed)) << rows << "x" << columns;
+  }
+
+  auto values = std::vector<int>(12);
+  EXPECT_DEATH(transpose_in_place(std::span(values), 3, 5), "");
+}
+
+}  // namespace tests
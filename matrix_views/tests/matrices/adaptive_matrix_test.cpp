@@ -0,0 +1,135 @@
+#include "matrices/adaptive_matrix.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "matrices/matrix.hpp"
+
+namespace tests {
+
+using namespace matrix_views::matrices;
+using namespace matrix_views::utils;
+using matrix_views::utils::index;
+
+namespace {
+
+// 3 x 4 matrix with the value of every element 10 * row + column
+matrix<int> make_matrix() {
+  auto m = matrix<int>(3, 4);
+  for (std::ptrdiff_t i = 0; i < 3; ++i) {
+    for (std::ptrdiff_t j = 0; j < 4; ++j) {
+      m({i, j}) = static_cast<int>(10 * i + j);
+    }
+  }
+  return m;
+}
+
+template <typename Range>
+std::vector<int> to_vector(const Range& range) {
+  return std::vector<int>(range.begin(), range.end());
+}
+
+template <typename Snapshot>
+void expect_elements(const Snapshot& snapshot) {
+  EXPECT_EQ(to_vector(snapshot.row(1)), (std::vector<int>{10, 11, 12, 13}));
+  EXPECT_EQ(to_vector(snapshot.column(2)), (std::vector<int>{2, 12, 22}));
+  EXPECT_EQ(to_vector(snapshot.diagonal(1)), (std::vector<int>{1, 12, 23}));
+  EXPECT_EQ(to_vector(snapshot.diagonal(-1)), (std::vector<int>{10, 21}));
+  EXPECT_EQ(to_vector(snapshot.antidiagonal(3)),
+            (std::vector<int>{3, 12, 21}));
+  EXPECT_EQ(snapshot(index{2, 3}), 23);
+
+  auto sum = 0;
+  for (const auto column : snapshot.stripes(kColumn)) {
+    sum = std::accumulate(column.begin(), column.end(), sum);
+  }
+  EXPECT_EQ(sum, 138);
+}
+
+template <typename Snapshot>
+concept hands_out_rows = requires(Snapshot&& snapshot) {
+  std::forward<Snapshot>(snapshot).row(0);
+  std::forward<Snapshot>(snapshot).stripes(kRow);
+};
+
+template <typename Snapshot>
+concept hands_out_storage = requires(Snapshot&& snapshot) {
+  std::forward<Snapshot>(snapshot).storage();
+};
+
+}  // namespace
+
+TEST(adaptive_matrix, starts_row_major) {
+  const auto m = adaptive_matrix<int>(make_matrix());
+  EXPECT_EQ(m.rows(), 3);
+  EXPECT_EQ(m.columns(), 4);
+  EXPECT_TRUE(m.row_major());
+  expect_elements(m.take_snapshot());
+}
+
+TEST(adaptive_matrix, relays_out_for_columns) {
+  const auto m = adaptive_matrix<int>(make_matrix(), 24);
+  const auto snapshot = m.take_snapshot();
+  for (std::ptrdiff_t j = 0; j < 8; ++j) {
+    static_cast<void>(snapshot.column(j % 4));
+  }
+  m.wait();
+
+  EXPECT_FALSE(m.row_major());
+  EXPECT_TRUE(snapshot.row_major());
+  expect_elements(snapshot);
+  expect_elements(m.take_snapshot());
+}
+
+TEST(adaptive_matrix, relays_out_back_for_rows) {
+  const auto m = adaptive_matrix<int>(make_matrix(), 24);
+  for (std::ptrdiff_t j = 0; j < 8; ++j) {
+    const auto snapshot = m.take_snapshot();
+    static_cast<void>(snapshot.column(j % 4));
+  }
+  m.wait();
+  ASSERT_FALSE(m.row_major());
+
+  for (std::ptrdiff_t i = 0; i < 6; ++i) {
+    const auto snapshot = m.take_snapshot();
+    static_cast<void>(snapshot.row(i % 3));
+  }
+  m.wait();
+  EXPECT_TRUE(m.row_major());
+  expect_elements(m.take_snapshot());
+}
+
+TEST(adaptive_matrix, keeps_layout_for_mixed_traversals) {
+  const auto m = adaptive_matrix<int>(make_matrix(), 24);
+  const auto snapshot = m.take_snapshot();
+  for (std::ptrdiff_t k = 0; k < 4; ++k) {
+    static_cast<void>(snapshot.column(k));
+    static_cast<void>(snapshot.row(k % 3));
+    static_cast<void>(snapshot.diagonal(k - 2));
+  }
+  m.wait();
+  EXPECT_TRUE(m.row_major());
+}
+
+TEST(adaptive_matrix, snapshot_lifetime) {
+  // Ranges of temporary snapshots would dangle once a relayout drops the
+  // storage
+  using snapshot_t = adaptive_matrix<int>::snapshot;
+  static_assert(hands_out_rows<const snapshot_t&>);
+  static_assert(!hands_out_rows<snapshot_t>);
+  static_assert(!hands_out_rows<const snapshot_t>);
+  static_assert(!hands_out_storage<snapshot_t>);
+
+  // Snapshots outlive the matrix and stop reporting their ranges
+  auto m = std::make_unique<adaptive_matrix<int>>(make_matrix(), 4);
+  const auto snapshot = m->take_snapshot();
+  m.reset();
+  expect_elements(snapshot);
+}
+
+}  // namespace tests
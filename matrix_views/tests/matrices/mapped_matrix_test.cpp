@@ -0,0 +1,136 @@
+#include "matrices/mapped_matrix.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+namespace tests {
+
+using namespace matrix_views::matrices;
+using namespace matrix_views::utils;
+using matrix_views::utils::index;
+
+namespace {
+
+using column_major_matrix_t =
+    mapped_matrix<const int, std::dynamic_extent, std::dynamic_extent,
+                  kColumnMajorTag>;
+
+// Binary file with 3x4 ints equal to their offsets, removed on destruction
+class matrix_file final {
+ public:
+  explicit matrix_file(std::size_t size = 12)
+      : path_(std::filesystem::temp_directory_path() /
+              ("mapped_matrix_test_" +
+               std::string(::testing::UnitTest::GetInstance()
+                               ->current_test_info()
+                               ->name()))) {
+    std::vector<int> values(size);
+    std::iota(values.begin(), values.end(), 0);
+    std::ofstream(path_, std::ios::binary)
+        .write(reinterpret_cast<const char*>(values.data()),
+               static_cast<std::streamsize>(size * sizeof(int)));
+  }
+  ~matrix_file() { std::filesystem::remove(path_); }
+
+  const std::filesystem::path& path() const noexcept { return path_; }
+
+ private:
+  std::filesystem::path path_;
+};
+
+}  // namespace
+
+TEST(mapped_matrix, enforce_concept) {
+  static_assert(std::ranges::contiguous_range<
+                decltype(std::declval<mapped_matrix<const int>>().row(0))>);
+  static_assert(!std::ranges::contiguous_range<
+                decltype(std::declval<mapped_matrix<const int>>().column(0))>);
+  static_assert(std::ranges::contiguous_range<
+                decltype(std::declval<column_major_matrix_t>().column(0))>);
+}
+
+TEST(mapped_matrix, read_only) {
+  const auto file = matrix_file();
+  const auto m = mapped_matrix<const int>(file.path(), 3, 4);
+
+  EXPECT_EQ(m.rows(), 3);
+  EXPECT_EQ(m.columns(), 4);
+  EXPECT_EQ(m({1, 2}), 6);
+  EXPECT_TRUE(std::ranges::equal(m.row(1), std::array{4, 5, 6, 7}));
+  EXPECT_TRUE(std::ranges::equal(m.column(3), std::array{3, 7, 11}));
+  EXPECT_TRUE(std::ranges::equal(m.diagonal(1), std::array{1, 6, 11}));
+  EXPECT_TRUE(std::ranges::equal(m.antidiagonal(3), std::array{3, 6, 9}));
+  EXPECT_EQ(m.row(2).data(), m.data() + 8);
+}
+
+TEST(mapped_matrix, column_major) {
+  const auto file = matrix_file();
+  const auto m =
+      mapped_matrix<const int, 3, 4, kColumnMajorTag>(file.path());
+
+  EXPECT_EQ(m({1, 2}), 7);
+  EXPECT_TRUE(std::ranges::equal(m.column(1), std::array{3, 4, 5}));
+  EXPECT_TRUE(std::ranges::equal(m.row(0), std::array{0, 3, 6, 9}));
+}
+
+TEST(mapped_matrix, stripes) {
+  const auto file = matrix_file();
+  const auto m = mapped_matrix<const int, 3, 4>(file.path());
+
+  auto sums = rows(m) | std::views::transform([](auto row) {
+                return std::accumulate(row.begin(), row.end(), 0);
+              });
+  EXPECT_TRUE(std::ranges::equal(sums, std::array{6, 22, 38}));
+  EXPECT_TRUE(std::ranges::equal(columns(m)[2], std::array{2, 6, 10}));
+  EXPECT_TRUE(std::ranges::equal(diagonals(m)[0], std::array{8}));
+}
+
+TEST(mapped_matrix, read_write) {
+  const auto file = matrix_file();
+  {
+    auto m = mapped_matrix<int>(file.path(), 3, 4);
+    std::ranges::fill(m.row(1), -1);
+    m({2, 3}) = 42;
+    m.flush();
+  }
+
+  const auto m = mapped_matrix<const int>(file.path(), 3, 4);
+  EXPECT_TRUE(std::ranges::equal(m.row(1), std::array{-1, -1, -1, -1}));
+  EXPECT_EQ(m({2, 3}), 42);
+  EXPECT_EQ(m({0, 3}), 3);
+}
+
+TEST(mapped_matrix, errors) {
+  const auto file = matrix_file(6);
+  EXPECT_THROW(mapped_matrix<const int>(file.path(), 3, 4), std::length_error);
+  EXPECT_NO_THROW(mapped_matrix<const int>(file.path(), 2, 3));
+  EXPECT_THROW(
+      mapped_matrix<const int>(file.path().string() + ".missing", 1, 1),
+      std::system_error);
+
+  // The size in bytes of the matrix would overflow
+  EXPECT_THROW(mapped_matrix<const int>(
+                   file.path(), std::size_t(1) << 32, std::size_t(1) << 31),
+               std::length_error);
+}
+
+TEST(mapped_matrix, dynamic_extents_are_required) {
+  const auto file = matrix_file();
+  static_assert(!std::is_constructible_v<mapped_matrix<const int>,
+                                         const std::filesystem::path&>);
+  static_assert(!std::is_constructible_v<mapped_matrix<const int, 3>,
+                                         const std::filesystem::path&>);
+  EXPECT_DEATH((mapped_matrix<const int, 3, 4>(file.path(), 4, 3)), "");
+}
+
+}  // namespace tests
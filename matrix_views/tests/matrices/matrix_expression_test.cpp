@@ -0,0 +1,98 @@
+#include "matrices/matrix_expression.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+
+#include "matrices/matrix.hpp"
+
+namespace tests {
+
+using namespace matrix_views::matrices;
+using namespace matrix_views::utils;
+using matrix_views::utils::index;
+
+namespace {
+
+// 3x4 matrix with the value of every element equal to its offset
+matrix<int> make_matrix() {
+  auto m = matrix<int>(3, 4);
+  std::iota(m.data(), m.data() + m.size(), 0);
+  return m;
+}
+
+}  // namespace
+
+TEST(matrix_expression, enforce_concept) {
+  const auto m = make_matrix();
+  static_assert(matrix_view_operand<decltype(m)&>);
+  static_assert(matrix_view_operand<decltype(m + m)>);
+  static_assert(!matrix_view_operand<matrix<int>>);
+  static_assert(
+      std::ranges::random_access_range<decltype((m * 2 + m).column(0))>);
+}
+
+TEST(matrix_expression, arithmetic) {
+  const auto a = make_matrix();
+  const auto b = matrix<int>(3, 4, 2);
+
+  const auto e = a * 3 - b / 2 + 1;
+  EXPECT_EQ(e.rows(), 3);
+  EXPECT_EQ(e.columns(), 4);
+  EXPECT_EQ(e({0, 0}), 0);
+  EXPECT_EQ(e({2, 3}), 33);
+  EXPECT_EQ((-a)({1, 1}), -5);
+  EXPECT_EQ((a * b)({1, 2}), 12);
+  EXPECT_EQ((12 / (a + 1))({0, 2}), 4);
+}
+
+TEST(matrix_expression, ranges) {
+  const auto a = make_matrix();
+  const auto e = a + a * 10;
+
+  EXPECT_TRUE(std::ranges::equal(e.row(1), std::array{44, 55, 66, 77}));
+  EXPECT_TRUE(std::ranges::equal(e.column(3), std::array{33, 77, 121}));
+  EXPECT_TRUE(std::ranges::equal(e.diagonal(1), std::array{11, 66, 121}));
+  EXPECT_TRUE(std::ranges::equal(e.antidiagonal(2), std::array{22, 55, 88}));
+  EXPECT_TRUE(std::ranges::equal(columns(e)[0], std::array{0, 44, 88}));
+}
+
+TEST(matrix_expression, map_and_zip_with) {
+  const auto a = make_matrix();
+
+  const auto squares = map(a, [](int x) { return x * x; });
+  EXPECT_EQ(squares({2, 1}), 81);
+
+  const auto clamped = zip_with(
+      [](int x, int low, int high) { return std::clamp(x, low, high); }, a,
+      map(a, [](int) { return 3; }), map(a, [](int) { return 7; }));
+  EXPECT_TRUE(std::ranges::equal(clamped.row(1), std::array{4, 5, 6, 7}));
+  EXPECT_TRUE(std::ranges::equal(clamped.row(2), std::array{7, 7, 7, 7}));
+}
+
+TEST(matrix_expression, mismatched_dimensions) {
+  const auto a = make_matrix();
+  const auto b = matrix<int>(4, 3);
+  EXPECT_DEATH(a + b, "");
+}
+
+TEST(matrix_expression, assign) {
+  auto a = make_matrix();
+  const auto b = matrix<int>(3, 4, 1);
+
+  assign(a, a * 2 + b);
+  EXPECT_TRUE(std::ranges::equal(a.row(0), std::array{1, 3, 5, 7}));
+  EXPECT_EQ(a({2, 3}), 23);
+
+  auto c = matrix<int, 3, 4>();
+  assign(c, -b);
+  EXPECT_EQ(std::accumulate(c.data(), c.data() + c.size(), 0), -12);
+
+  // The destination must have the dimensions of the source
+  auto d = matrix<int>(3, 5);
+  EXPECT_DEATH(assign(d, -b), "");
+}
+
+}  // namespace tests
@@ -0,0 +1,179 @@
+#include "matrices/matrix.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+
+namespace tests {
+
+using namespace matrix_views::matrices;
+using namespace matrix_views::utils;
+using matrix_views::utils::index;
+
+namespace {
+
+using dynamic_matrix_t = matrix<int>;
+using static_matrix_t = matrix<int, 3, 4>;
+using column_major_matrix_t =
+    matrix<int, std::dynamic_extent, std::dynamic_extent, kColumnMajorTag>;
+
+// Fills the matrix so that the value of every element is 10 * row + column
+template <typename Matrix>
+Matrix make_matrix(Matrix matrix) {
+  for (std::ptrdiff_t i = 0; i < std::ssize(matrix.column(0)); ++i) {
+    for (std::ptrdiff_t j = 0; j < std::ssize(matrix.row(0)); ++j) {
+      matrix({i, j}) = static_cast<int>(10 * i + j);
+    }
+  }
+  return matrix;
+}
+
+template <typename Matrix>
+concept tiles_without_size = requires(Matrix& m) { m.tiles(); };
+
+}  // namespace
+
+TEST(matrix, enforce_concept) {
+  static_assert(
+      std::ranges::contiguous_range<decltype(dynamic_matrix_t().row(0))>);
+  static_assert(
+      !std::ranges::contiguous_range<decltype(dynamic_matrix_t().column(0))>);
+  static_assert(std::ranges::contiguous_range<
+                decltype(column_major_matrix_t().column(0))>);
+  static_assert(std::ranges::random_access_range<
+                decltype(static_matrix_t().antidiagonal(0))>);
+}
+
+TEST(matrix, static_sizeof) {
+  static_assert(sizeof(static_matrix_t) ==
+                sizeof(std::vector<int, aligned_allocator<int>>));
+  static_assert(sizeof(static_matrix_t().row(0).begin()) ==
+                sizeof(basic_index<std::int32_t>) + sizeof(int*));
+}
+
+TEST(matrix, constructor) {
+  const auto m1 = dynamic_matrix_t(3, 4, 7);
+  EXPECT_EQ(m1.rows(), 3);
+  EXPECT_EQ(m1.columns(), 4);
+  EXPECT_EQ(m1.size(), 12);
+  EXPECT_EQ(m1({2, 3}), 7);
+
+  const auto m2 = static_matrix_t();
+  EXPECT_EQ(m2.rows(), 3);
+  EXPECT_EQ(m2.columns(), 4);
+  EXPECT_EQ(m2({2, 3}), 0);
+
+  EXPECT_EQ(dynamic_matrix_t().size(), 0);
+}
+
+TEST(matrix, alignment) {
+  const auto m = dynamic_matrix_t(5, 5);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(m.data()) % kCacheLineSize, 0);
+}
+
+TEST(matrix, row_major_layout) {
+  const auto m = make_matrix(dynamic_matrix_t(3, 4));
+  EXPECT_EQ(m.data()[1], 1);
+  EXPECT_EQ(m.data()[4], 10);
+}
+
+TEST(matrix, column_major_layout) {
+  const auto m = make_matrix(column_major_matrix_t(3, 4));
+  EXPECT_EQ(m.data()[1], 10);
+  EXPECT_EQ(m.data()[3], 1);
+}
+
+TEST(matrix, row) {
+  const auto m = make_matrix(static_matrix_t());
+  EXPECT_TRUE(std::ranges::equal(m.row(1), std::array{10, 11, 12, 13}));
+  EXPECT_EQ(m.row(2).data(), m.data() + 8);
+}
+
+TEST(matrix, column) {
+  const auto m = make_matrix(column_major_matrix_t(3, 4));
+  EXPECT_TRUE(std::ranges::equal(m.column(2), std::array{2, 12, 22}));
+  EXPECT_EQ(m.column(1).data(), m.data() + 3);
+}
+
+TEST(matrix, diagonal) {
+  const auto m = make_matrix(dynamic_matrix_t(3, 4));
+  EXPECT_TRUE(std::ranges::equal(m.diagonal(0), std::array{0, 11, 22}));
+  EXPECT_TRUE(std::ranges::equal(m.diagonal(2), std::array{2, 13}));
+  EXPECT_TRUE(std::ranges::equal(m.diagonal(-1), std::array{10, 21}));
+}
+
+TEST(matrix, antidiagonal) {
+  const auto m = make_matrix(column_major_matrix_t(3, 4));
+  EXPECT_TRUE(std::ranges::equal(m.antidiagonal(0), std::array{0}));
+  EXPECT_TRUE(std::ranges::equal(m.antidiagonal(3), std::array{3, 12, 21}));
+  EXPECT_TRUE(std::ranges::equal(m.antidiagonal(5), std::array{23}));
+}
+
+TEST(matrix, mutable_ranges) {
+  auto m = dynamic_matrix_t(3, 4);
+  std::ranges::fill(m.row(1), 1);
+  std::ranges::fill(m.column(3), 2);
+  std::ranges::fill(m.diagonal(0), 3);
+
+  EXPECT_EQ(m({1, 0}), 1);
+  EXPECT_EQ(m({1, 3}), 2);
+  EXPECT_EQ(m({1, 1}), 3);
+  EXPECT_EQ(std::accumulate(m.data(), m.data() + m.size(), 0),
+            1 * 2 + 2 * 3 + 3 * 3);
+}
+
+TEST(matrix, rows) {
+  auto m = static_matrix_t();
+  int value = 0;
+  for (auto row : rows(m)) {
+    std::ranges::fill(row, value++);
+  }
+
+  EXPECT_EQ(std::ssize(rows(m)), 3);
+  EXPECT_EQ(m({2, 3}), 2);
+  EXPECT_EQ(m({0, 1}), 0);
+}
+
+TEST(matrix, stripes) {
+  const auto m = make_matrix(dynamic_matrix_t(3, 4));
+
+  EXPECT_TRUE(std::ranges::equal(columns(m)[2], std::array{2, 12, 22}));
+  EXPECT_TRUE(std::ranges::equal(diagonals(m)[0], std::array{20}));
+  EXPECT_TRUE(std::ranges::equal(antidiagonals(m)[3], std::array{3, 12, 21}));
+
+  auto sums = rows(m) | std::views::transform([](auto row) {
+                return std::accumulate(row.begin(), row.end(), 0);
+              });
+  EXPECT_TRUE(std::ranges::equal(sums, std::array{6, 46, 86}));
+}
+
+TEST(matrix, tiles) {
+  auto m = make_matrix(dynamic_matrix_t(3, 4));
+  EXPECT_EQ(std::ssize(tiles(m, 2)), 4);
+  EXPECT_EQ(std::ssize(m.tiles<3>()), 2);
+
+  const auto tile = tiles(m, 2)[3];
+  EXPECT_EQ(tile.rows(), 1);
+  EXPECT_EQ(tile.columns(), 2);
+  EXPECT_TRUE(std::ranges::equal(tile[0], std::array{22, 23}));
+
+  for (auto tile : m.tiles<2>()) {
+    for (auto column : tile.stripes(kColumn)) {
+      std::ranges::fill(column, 1);
+    }
+  }
+  EXPECT_EQ(std::accumulate(m.data(), m.data() + m.size(), 0), 12);
+}
+
+TEST(matrix, tiles_require_size) {
+  auto m = dynamic_matrix_t(3, 4);
+
+  // Without a tile size in the type it must be passed and be positive
+  static_assert(!tiles_without_size<dynamic_matrix_t>);
+  EXPECT_DEATH(m.tiles(0), "");
+  EXPECT_DEATH(m.tiles<2>(3), "");
+}
+
+}  // namespace tests
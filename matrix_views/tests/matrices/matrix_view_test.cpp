@@ -0,0 +1,138 @@
+#include "matrices/matrix_view.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+
+#include "matrices/matrix.hpp"
+#include "matrices/matrix_expression.hpp"
+#include "storage/strided_storage_proxy.hpp"
+
+namespace tests {
+
+using namespace matrix_views::matrices;
+using namespace matrix_views::storage;
+using namespace matrix_views::utils;
+using matrix_views::utils::index;
+
+namespace {
+
+using static_matrix_t = matrix<int, 3, 4>;
+using column_major_matrix_t =
+    matrix<int, std::dynamic_extent, std::dynamic_extent, kColumnMajorTag>;
+
+// Fills the matrix so that the value of every element is 10 * row + column
+template <typename Matrix>
+Matrix make_matrix(Matrix matrix) {
+  for (std::ptrdiff_t i = 0; i < std::ssize(matrix.column(0)); ++i) {
+    for (std::ptrdiff_t j = 0; j < std::ssize(matrix.row(0)); ++j) {
+      matrix({i, j}) = static_cast<int>(10 * i + j);
+    }
+  }
+  return matrix;
+}
+
+}  // namespace
+
+TEST(matrix_view, static_extents) {
+  auto m = static_matrix_t();
+
+  using submatrix_t = decltype(submatrix<2, 2>(m, {1, 1}));
+  static_assert(std::is_same_v<submatrix_t,
+                               matrix_view<strided_storage_proxy<int, 4, 1>,
+                                           2, 2>>);
+  static_assert(kRowsOf<submatrix_t> == 2 && kColumnsOf<submatrix_t> == 2);
+
+  using transpose_t = decltype(transpose(m));
+  static_assert(std::is_same_v<transpose_t,
+                               matrix_view<strided_storage_proxy<int, 1, 4>,
+                                           4, 3>>);
+  static_assert(kRowsOf<transpose_t> == 4 && kColumnsOf<transpose_t> == 3);
+
+  static_assert(kRowsOf<decltype(m + m)> == 3);
+  static_assert(kColumnsOf<decltype(m + m)> == 4);
+}
+
+TEST(matrix_view, transpose) {
+  const auto m = make_matrix(static_matrix_t());
+  const auto t = transpose(m);
+
+  EXPECT_EQ(t.rows(), 4);
+  EXPECT_EQ(t.columns(), 3);
+  EXPECT_EQ(t({3, 1}), 13);
+  EXPECT_TRUE(std::ranges::equal(t.row(2), m.column(2)));
+  EXPECT_TRUE(std::ranges::equal(t.column(1), m.row(1)));
+  EXPECT_TRUE(std::ranges::equal(t.diagonal(1), m.diagonal(-1)));
+  EXPECT_TRUE(std::ranges::equal(t.antidiagonal(2),
+                                 std::array{20, 11, 2}));
+
+  // Rows of a row-major matrix become contiguous columns
+  static_assert(std::ranges::contiguous_range<decltype(t.column(0))>);
+  EXPECT_EQ(t.column(1).data(), m.data() + 4);
+
+  EXPECT_TRUE(std::ranges::equal(transpose(t).row(1), m.row(1)));
+}
+
+TEST(matrix_view, submatrix) {
+  const auto m = make_matrix(column_major_matrix_t(4, 5));
+  const auto s = submatrix(m, {1, 2}, 3, 2);
+
+  EXPECT_EQ(s.rows(), 3);
+  EXPECT_EQ(s.columns(), 2);
+  EXPECT_EQ(s({0, 0}), 12);
+  EXPECT_TRUE(std::ranges::equal(s.row(2), std::array{32, 33}));
+  EXPECT_TRUE(std::ranges::equal(s.column(1), std::array{13, 23, 33}));
+  EXPECT_TRUE(std::ranges::equal(s.diagonal(0), std::array{12, 23}));
+  EXPECT_TRUE(std::ranges::equal(s.antidiagonal(1), std::array{13, 22}));
+  EXPECT_EQ(s.column(0).data(), &m({1, 2}));
+
+  const auto nested = submatrix<2, 1>(s, {1, 1});
+  EXPECT_TRUE(std::ranges::equal(nested.column(0), std::array{23, 33}));
+
+  // Dynamic extents are passed at runtime and the part must fit
+  static_assert(![](const auto& matrix) {
+    return requires { submatrix(matrix, index{0, 0}); };
+  }(m));
+  EXPECT_DEATH(submatrix(m, {2, 4}, 3, 2), "");
+  EXPECT_DEATH((submatrix<2, 2>(s, {2, 0})), "");
+}
+
+TEST(matrix_view, mutable_views) {
+  auto m = static_matrix_t();
+
+  for (auto row : rows(submatrix(m, {1, 1}, 2, 2))) {
+    std::ranges::fill(row, 1);
+  }
+  std::ranges::fill(transpose(m).row(3), 2);
+
+  EXPECT_EQ(m({1, 1}), 1);
+  EXPECT_EQ(m({2, 2}), 1);
+  EXPECT_EQ(m({1, 3}), 2);
+  EXPECT_EQ(std::accumulate(m.data(), m.data() + m.size(), 0), 4 + 2 * 3);
+}
+
+TEST(matrix_view, generic_storage_proxies) {
+  const auto m = make_matrix(static_matrix_t());
+
+  // Expressions have no pointer to advance, so the adaptors wrap them
+  const auto t = transpose(m * 2);
+  const auto s = submatrix(t, {1, 1}, 2, 2);
+  EXPECT_TRUE(std::ranges::equal(t.row(3), std::array{6, 26, 46}));
+  EXPECT_TRUE(std::ranges::equal(s.row(1), std::array{24, 44}));
+  EXPECT_TRUE(std::ranges::equal(transpose(s).row(0), std::array{22, 24}));
+
+  static_assert(std::is_same_v<decltype(submatrix(s, {1, 1}, 1, 1).storage()),
+                               decltype(s.storage())>);
+}
+
+TEST(matrix_view, tiles) {
+  const auto m = make_matrix(static_matrix_t());
+  const auto t = transpose(m);
+
+  EXPECT_EQ(std::ssize(t.tiles<2>()), 4);
+  EXPECT_TRUE(std::ranges::equal(t.tiles(2)[2][0], std::array{2, 12}));
+}
+
+}  // namespace tests
@@ -0,0 +1,83 @@
+#include "matrices/sparse_matrix.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+
+namespace tests {
+
+using namespace matrix_views::matrices;
+using namespace matrix_views::utils;
+using matrix_views::utils::index;
+
+namespace {
+
+using csr_matrix_t = sparse_matrix<int>;
+using csc_matrix_t = sparse_matrix<int, kColumnMajorTag>;
+
+// 3 x 4 matrix
+// 0 1 0 2
+// 0 0 0 0
+// 3 0 4 0
+matrix<int, 3, 4> make_dense() {
+  auto dense = matrix<int, 3, 4>();
+  dense({0, 1}) = 1, dense({0, 3}) = 2, dense({2, 0}) = 3, dense({2, 2}) = 4;
+  return dense;
+}
+
+}  // namespace
+
+TEST(sparse_matrix, constructor) {
+  const auto m = csr_matrix_t(3, 4, {0, 2, 2, 4}, {1, 3, 0, 2}, {1, 2, 3, 4});
+  EXPECT_EQ(m.rows(), 3);
+  EXPECT_EQ(m.columns(), 4);
+  EXPECT_EQ(m.nonzeros_count(), 4);
+  EXPECT_EQ(m({2, 2}), 4);
+  EXPECT_EQ(m({1, 1}), 0);
+
+  EXPECT_EQ(csr_matrix_t().nonzeros_count(), 0);
+}
+
+TEST(sparse_matrix, from_dense) {
+  const auto dense = make_dense();
+  const auto csr = csr_matrix_t(dense);
+  const auto csc = csc_matrix_t(dense);
+
+  for (std::ptrdiff_t i = 0; i < 3; ++i) {
+    for (std::ptrdiff_t j = 0; j < 4; ++j) {
+      EXPECT_EQ(csr({i, j}), dense({i, j}));
+      EXPECT_EQ(csc({i, j}), dense({i, j}));
+    }
+  }
+}
+
+TEST(sparse_matrix, dense_views) {
+  const auto dense = make_dense();
+  const auto csr = csr_matrix_t(dense);
+  const auto csc = csc_matrix_t(dense);
+
+  EXPECT_TRUE(std::ranges::equal(csr.row(0), dense.row(0)));
+  EXPECT_TRUE(std::ranges::equal(csr.column(2), dense.column(2)));
+  EXPECT_TRUE(std::ranges::equal(csc.row(2), dense.row(2)));
+  EXPECT_EQ(csc.column(3)[0], 2);
+}
+
+TEST(sparse_matrix, nonzeros) {
+  const auto dense = make_dense();
+  const auto csr = csr_matrix_t(dense);
+  const auto csc = csc_matrix_t(dense);
+
+  const auto values = [](auto&& nonzeros) {
+    return nonzeros | std::views::values;
+  };
+  EXPECT_TRUE(std::ranges::equal(values(csr.nonzeros(kRow, 0)),
+                                 std::array{1, 2}));
+  EXPECT_TRUE(std::ranges::empty(csr.nonzeros(kRow, 1)));
+  EXPECT_TRUE(std::ranges::equal(values(csc.nonzeros(kColumn, 2)),
+                                 std::array{4}));
+  EXPECT_EQ(csc.nonzeros(kColumn, 0)[0].first, (index{2, 0}));
+}
+
+}  // namespace tests
@@ -0,0 +1,165 @@
+#include "matrices/tiled_matrix.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <filesystem>
+#include <numeric>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+namespace tests {
+
+using namespace matrix_views::matrices;
+using namespace matrix_views::utils;
+using matrix_views::utils::index;
+
+namespace {
+
+// Tiled file of a 5x7 matrix with the value of every element equal to
+// 10 * row + column, removed on destruction
+class matrix_file final {
+ public:
+  explicit matrix_file(std::size_t tile_size = 2)
+      : path_(std::filesystem::temp_directory_path() /
+              ("tiled_matrix_test_" +
+               std::string(::testing::UnitTest::GetInstance()
+                               ->current_test_info()
+                               ->name()))) {
+    auto dense = matrix<int>(5, 7);
+    for (std::ptrdiff_t i = 0; i < 5; ++i) {
+      for (std::ptrdiff_t j = 0; j < 7; ++j) {
+        dense({i, j}) = static_cast<int>(10 * i + j);
+      }
+    }
+    tiled_matrix<int>::store(path_, dense, tile_size);
+  }
+  ~matrix_file() { std::filesystem::remove(path_); }
+
+  const std::filesystem::path& path() const noexcept { return path_; }
+
+ private:
+  std::filesystem::path path_;
+};
+
+// Budget for the given number of 2x2 int tiles
+constexpr std::size_t tiles_budget(std::size_t tiles) {
+  return tiles * 2 * 2 * sizeof(int);
+}
+
+}  // namespace
+
+TEST(tiled_matrix, enforce_concept) {
+  static_assert(std::ranges::random_access_range<
+                decltype(std::declval<tiled_matrix<int>>().row(0))>);
+  static_assert(std::ranges::random_access_range<
+                decltype(std::declval<tiled_matrix<int>>().stripes(kColumn))>);
+}
+
+TEST(tiled_matrix, file_size) {
+  const auto file = matrix_file();
+  EXPECT_EQ(std::filesystem::file_size(file.path()),
+            3 * 4 * 2 * 2 * sizeof(int));
+}
+
+TEST(tiled_matrix, access) {
+  const auto file = matrix_file();
+  const auto m = tiled_matrix<int>(file.path(), 5, 7, 2, tiles_budget(4));
+
+  EXPECT_EQ(m.rows(), 5);
+  EXPECT_EQ(m.columns(), 7);
+  EXPECT_EQ(m.tile_size(), 2);
+  EXPECT_EQ(m({0, 0}), 0);
+  EXPECT_EQ(m({3, 5}), 35);
+  EXPECT_EQ(m({4, 6}), 46);
+}
+
+TEST(tiled_matrix, ranges) {
+  const auto file = matrix_file(3);
+  const auto m = tiled_matrix<int>(file.path(), 5, 7, 3, 0);
+
+  EXPECT_TRUE(std::ranges::equal(m.row(4), std::array{40, 41, 42, 43, 44,
+                                                       45, 46}));
+  EXPECT_TRUE(std::ranges::equal(m.column(5), std::array{5, 15, 25, 35, 45}));
+  EXPECT_TRUE(std::ranges::equal(m.diagonal(2), std::array{2, 13, 24, 35, 46}));
+  EXPECT_TRUE(std::ranges::equal(m.antidiagonal(6),
+                                 std::array{6, 15, 24, 33, 42}));
+
+  auto sums = rows(m) | std::views::transform([](auto row) {
+                return std::accumulate(row.begin(), row.end(), 0);
+              });
+  EXPECT_TRUE(std::ranges::equal(sums, std::array{21, 91, 161, 231, 301}));
+}
+
+TEST(tiled_matrix, lru) {
+  const auto file = matrix_file();
+  const auto m = tiled_matrix<int>(file.path(), 5, 7, 2, tiles_budget(2));
+
+  EXPECT_EQ(m({0, 0}), 0);
+  EXPECT_EQ(m({0, 2}), 2);
+  EXPECT_EQ(m({1, 1}), 11);
+  EXPECT_EQ(m.stats().misses, 2);
+  EXPECT_EQ(m.stats().hits, 1);
+  EXPECT_EQ(m.stats().evictions, 0);
+
+  // Evicts the tile of {0, 2} since {0, 0} was used more recently
+  EXPECT_EQ(m({2, 0}), 20);
+  EXPECT_EQ(m.stats().evictions, 1);
+  EXPECT_EQ(m({1, 0}), 10);
+  EXPECT_EQ(m.stats().hits, 2);
+  EXPECT_EQ(m({1, 3}), 13);
+  EXPECT_EQ(m.stats().misses, 4);
+  EXPECT_EQ(m.stats().evictions, 2);
+}
+
+TEST(tiled_matrix, sequential_sweep) {
+  const auto file = matrix_file();
+  const auto m = tiled_matrix<int>(file.path(), 5, 7, 2, tiles_budget(4));
+
+  // Every iterator looks the cache up only when it enters another tile
+  const auto row = m.row(0);
+  EXPECT_EQ(std::accumulate(row.begin(), row.end(), 0), 21);
+  EXPECT_EQ(m.stats().misses + m.stats().hits, 4);
+  EXPECT_EQ(m.stats().misses, 4);
+  EXPECT_EQ(m.stats().prefetches, 2);
+
+  const auto column = m.column(1);
+  EXPECT_EQ(std::accumulate(column.begin(), column.end(), 0), 105);
+  EXPECT_EQ(m.stats().hits, 1);
+  EXPECT_EQ(m.stats().misses, 6);
+}
+
+TEST(tiled_matrix, evicted_tiles) {
+  const auto file = matrix_file();
+  const auto m = tiled_matrix<int>(file.path(), 5, 7, 2, tiles_budget(1));
+
+  // Both iterators evict the tile of the other on every access
+  const auto top = m.row(0);
+  const auto bottom = m.row(4);
+  auto it = top.begin();
+  auto that = bottom.begin();
+  for (std::ptrdiff_t j = 0; j < 7; ++j, ++it, ++that) {
+    EXPECT_EQ(*it, j);
+    EXPECT_EQ(*that, 40 + j);
+  }
+
+  const auto diagonal = m.diagonal(0);
+  const auto antidiagonal = m.antidiagonal(4);
+  EXPECT_TRUE(std::ranges::equal(std::views::reverse(diagonal),
+                                 std::array{44, 33, 22, 11, 0}));
+  EXPECT_TRUE(std::ranges::equal(antidiagonal,
+                                 std::array{4, 13, 22, 31, 40}));
+}
+
+TEST(tiled_matrix, errors) {
+  const auto file = matrix_file();
+  EXPECT_THROW(tiled_matrix<int>(file.path(), 5, 9, 2, 0), std::length_error);
+  EXPECT_THROW(
+      tiled_matrix<int>(file.path().string() + ".missing", 1, 1, 1, 0),
+      std::system_error);
+}
+
+}  // namespace tests
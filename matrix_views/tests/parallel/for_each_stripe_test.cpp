@@ -0,0 +1,76 @@
+#include "parallel/for_each_stripe.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <mutex>
+#include <numeric>
+#include <vector>
+
+#include "matrices/matrix.hpp"
+
+namespace tests {
+
+using namespace matrix_views::matrices;
+using namespace matrix_views::parallel;
+using namespace matrix_views::utils;
+using matrix_views::utils::index;
+
+namespace {
+
+using matrix_t = matrix<int>;
+
+}  // namespace
+
+TEST(parallel_for_each_stripe, visits_every_element_once) {
+  auto pool = thread_pool(4);
+  auto m = matrix_t(53, 31);
+
+  const auto increment = [](auto stripe) {
+    for (auto& value : stripe) {
+      ++value;
+    }
+  };
+  parallel_for_each_stripe(pool, m, kRow, increment);
+  parallel_for_each_stripe(pool, m, kColumn, increment);
+  parallel_for_each_stripe(pool, m, kDiagonal, increment);
+  parallel_for_each_stripe(pool, m, kAntidiagonal, increment);
+
+  EXPECT_TRUE(std::all_of(m.data(), m.data() + m.size(),
+                          [](int value) { return value == 4; }));
+}
+
+TEST(parallel_for_each_stripe, splits_by_length) {
+  auto pool = thread_pool(4);
+  const auto m = matrix_t(16, 16);
+
+  std::mutex mutex;
+  std::vector<std::ptrdiff_t> sizes;
+  parallel_for_each_stripe(
+      pool, diagonals(m),
+      [&](auto stripe) {
+        const std::lock_guard lock(mutex);
+        sizes.push_back(std::ssize(stripe));
+      },
+      10);
+
+  // 256 elements in chunks of 10, long diagonals are cut between chunks
+  EXPECT_EQ(std::accumulate(sizes.begin(), sizes.end(), std::ptrdiff_t()),
+            256);
+  EXPECT_LE(*std::max_element(sizes.begin(), sizes.end()), 10);
+  EXPECT_GT(std::ssize(sizes), 31);
+}
+
+TEST(parallel_for_each_stripe, default_pool) {
+  auto m = matrix<int, 7, 5>();
+  std::atomic<int> count = 0;
+  parallel_for_each_stripe(m, kColumn, [&](auto stripe) {
+    count += static_cast<int>(std::ssize(stripe));
+  });
+  EXPECT_EQ(count, 35);
+
+  parallel_for_each_stripe(matrix_t(), kRow,
+                           [](auto) { FAIL() << "empty matrix"; });
+}
+
+}  // namespace tests
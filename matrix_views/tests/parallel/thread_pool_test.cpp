@@ -0,0 +1,60 @@
+#include "parallel/thread_pool.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+namespace tests {
+
+using namespace matrix_views::parallel;
+
+TEST(thread_pool, size) {
+  EXPECT_EQ(thread_pool(4).size(), 4);
+  EXPECT_EQ(thread_pool(0).size(), 1);
+  EXPECT_GE(default_thread_pool().size(), 1);
+}
+
+TEST(thread_pool, for_each_index) {
+  auto pool = thread_pool(4);
+  for (const std::ptrdiff_t count : {0, 1, 3, 4, 1000}) {
+    std::vector<std::atomic<int>> visits(static_cast<std::size_t>(count));
+    pool.for_each_index(count, [&](std::ptrdiff_t i) { ++visits[i]; });
+    for (const auto& visit : visits) {
+      EXPECT_EQ(visit, 1);
+    }
+  }
+}
+
+TEST(thread_pool, unbalanced) {
+  // The first slice holds all the expensive indices, others steal from it
+  auto pool = thread_pool(4);
+  std::atomic<long long> total = 0;
+  pool.for_each_index(64, [&](std::ptrdiff_t i) {
+    long long sum = 0;
+    for (std::ptrdiff_t k = 0; k < (i < 16 ? 100000 : 1); ++k) {
+      sum += k % 3;
+    }
+    total += sum;
+  });
+  EXPECT_EQ(total, 16 * 99999);
+}
+
+TEST(thread_pool, exception) {
+  auto pool = thread_pool(3);
+  EXPECT_THROW(pool.for_each_index(100,
+                                   [](std::ptrdiff_t i) {
+                                     if (i == 42) {
+                                       throw std::runtime_error("42");
+                                     }
+                                   }),
+               std::runtime_error);
+
+  std::atomic<std::ptrdiff_t> sum = 0;
+  pool.for_each_index(100, [&](std::ptrdiff_t i) { sum += i; });
+  EXPECT_EQ(sum, 99 * 100 / 2);
+}
+
+}  // namespace tests
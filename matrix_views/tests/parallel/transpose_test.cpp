@@ -0,0 +1,49 @@
+#include "parallel/transpose.hpp"
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "matrices/matrix.hpp"
+
+namespace tests {
+
+using namespace matrix_views::matrices;
+using namespace matrix_views::parallel;
+using namespace matrix_views::utils;
+using matrix_views::utils::index;
+
+TEST(parallel_transpose, matches_transpose) {
+  auto pool = thread_pool(4);
+  for (const auto& [rows, columns] :
+       std::vector<std::pair<std::size_t, std::size_t>>{
+           {3, 5}, {300, 211}, {211, 300}, {1000, 17}}) {
+    auto source = matrix<float>(rows, columns);
+    std::iota(source.data(), source.data() + source.size(), 0.f);
+    auto destination = matrix<float>(columns, rows);
+    parallel_transpose(pool, source, destination);
+
+    for (std::ptrdiff_t i = 0; i < static_cast<std::ptrdiff_t>(rows); ++i) {
+      for (std::ptrdiff_t j = 0; j < static_cast<std::ptrdiff_t>(columns);
+           ++j) {
+        ASSERT_EQ(source({i, j}), destination({j, i})) << i << ", " << j;
+      }
+    }
+  }
+}
+
+TEST(parallel_transpose, checks_destination) {
+  const auto source = matrix<float>(3, 5);
+  auto destination = matrix<float>(3, 5);
+
+  // The pool is started in the death test, which forks before any thread
+  EXPECT_DEATH(([&] {
+                 auto pool = thread_pool(2);
+                 parallel_transpose(pool, source, destination);
+               }()),
+               "");
+}
+
+}  // namespace tests
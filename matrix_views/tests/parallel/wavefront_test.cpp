@@ -0,0 +1,80 @@
+#include "parallel/wavefront.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string_view>
+
+#include "matrices/matrix.hpp"
+
+namespace tests {
+
+using namespace matrix_views::matrices;
+using namespace matrix_views::parallel;
+using matrix_views::utils::index;
+
+namespace {
+
+using matrix_t = matrix<int>;
+
+// Longest path to the cell, which is row + column + 1 only if every cell is
+// updated after its upper, left and upper left neighbours
+auto make_longest_path(matrix_t& m) {
+  return [&m](index index) {
+    const auto at = [&m](std::ptrdiff_t i, std::ptrdiff_t j) {
+      return i < 0 || j < 0 ? 0 : m({i, j});
+    };
+    m(index) = 1 + std::max({at(index.row - 1, index.column),
+                             at(index.row, index.column - 1),
+                             at(index.row - 1, index.column - 1)});
+  };
+}
+
+auto make_edit_distance(matrix_t& m, std::string_view lhs,
+                        std::string_view rhs) {
+  return [&m, lhs, rhs](index index) {
+    const auto [i, j] = index;
+    if (i == 0 || j == 0) {
+      m(index) = static_cast<int>(i + j);
+      return;
+    }
+    m(index) = std::min({m({i - 1, j}) + 1, m({i, j - 1}) + 1,
+                         m({i - 1, j - 1}) + (lhs[i - 1] != rhs[j - 1])});
+  };
+}
+
+}  // namespace
+
+TEST(parallel_wavefront, dependencies) {
+  auto pool = thread_pool(4);
+  for (const std::size_t tile_size : {0, 1, 3, 16, 100}) {
+    auto m = matrix_t(37, 53);
+    parallel_wavefront(pool, m.rows(), m.columns(), make_longest_path(m),
+                       tile_size);
+
+    for (std::ptrdiff_t i = 0; i < 37; ++i) {
+      for (std::ptrdiff_t j = 0; j < 53; ++j) {
+        ASSERT_EQ(m({i, j}), i + j + 1) << "tile size " << tile_size;
+      }
+    }
+  }
+}
+
+TEST(parallel_wavefront, edit_distance) {
+  constexpr std::string_view lhs = "intention", rhs = "execution";
+
+  auto m = matrix_t(lhs.size() + 1, rhs.size() + 1);
+  parallel_wavefront(m.rows(), m.columns(), make_edit_distance(m, lhs, rhs));
+  EXPECT_EQ(m({9, 9}), 5);
+
+  std::ranges::fill(m.row(9), 0);
+  parallel_wavefront(m.rows(), m.columns(), make_edit_distance(m, lhs, rhs), 4);
+  EXPECT_EQ(m({9, 9}), 5);
+}
+
+TEST(parallel_wavefront, empty) {
+  parallel_wavefront(0, 5, [](index) { FAIL() << "empty grid"; });
+  parallel_wavefront(5, 0, [](index) { FAIL() << "empty grid"; }, 2);
+}
+
+}  // namespace tests
@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <numeric>
+#include <ranges>
+#include <vector>
+
+#include "ranges/tagged_random_access_range.hpp"
+#include "storage/banded_storage_proxy.hpp"
+#include "storage/packed_symmetric_storage_proxy.hpp"
+#include "storage/packed_triangular_storage_proxy.hpp"
+
+namespace tests {
+
+using namespace matrix_views::ranges;
+using namespace matrix_views::storage;
+using namespace matrix_views::utils;
+using matrix_views::utils::index;
+
+namespace {
+
+// Packed 4x4 upper triangle or 4x4 tridiagonal band with the value of every
+// element equal to its offset plus one
+constexpr auto kPacked = [] {
+  std::array<int, 12> packed;
+  std::iota(packed.begin(), packed.end(), 1);
+  return packed;
+}();
+
+using upper_storage_proxy_t =
+    packed_triangular_storage_proxy<const int, kUpperTag, 4>;
+using lower_storage_proxy_t =
+    packed_triangular_storage_proxy<const int, kLowerTag, 4>;
+using tridiagonal_storage_proxy_t = banded_storage_proxy<const int, 1, 1>;
+
+template <typename Range>
+std::vector<int> to_vector(const Range& range) {
+  return std::vector<int>(range.begin(), range.end());
+}
+
+}  // namespace
+
+TEST(banded_tagged_random_access_range, enforce_concept) {
+  static_assert(tagged_random_access_range_banded_storage_proxy<
+                upper_storage_proxy_t>);
+  static_assert(tagged_random_access_range_banded_storage_proxy<
+                tridiagonal_storage_proxy_t>);
+  static_assert(!tagged_random_access_range_banded_storage_proxy<
+                packed_symmetric_storage_proxy<const int>>);
+  static_assert(std::ranges::random_access_range<
+                tagged_random_access_range<kRowTag, upper_storage_proxy_t>>);
+}
+
+TEST(banded_tagged_random_access_range, upper_stripes) {
+  const auto proxy = upper_storage_proxy_t(kPacked.data());
+
+  // 1  2  3  4
+  // 0  5  6  7
+  // 0  0  8  9
+  // 0  0  0 10
+  const auto row =
+      tagged_random_access_range<kRowTag, upper_storage_proxy_t, 4, 4>(
+          kRow, {2, 0}, proxy);
+  EXPECT_EQ(to_vector(row), (std::vector{0, 0, 8, 9}));
+  EXPECT_EQ(to_vector(row.structural_nonzeros()), (std::vector{8, 9}));
+
+  const auto column =
+      tagged_random_access_range<kColumnTag, upper_storage_proxy_t, 4, 4>(
+          kColumn, {0, 1}, proxy);
+  EXPECT_EQ(to_vector(column), (std::vector{2, 5, 0, 0}));
+  EXPECT_EQ(to_vector(column.structural_nonzeros()), (std::vector{2, 5}));
+
+  const auto diagonal =
+      tagged_random_access_range<kDiagonalTag, upper_storage_proxy_t, 4, 4>(
+          kDiagonal, {0, 1}, proxy);
+  EXPECT_EQ(to_vector(diagonal.structural_nonzeros()),
+            (std::vector{2, 6, 9}));
+
+  const auto subdiagonal =
+      tagged_random_access_range<kDiagonalTag, upper_storage_proxy_t, 4, 4>(
+          kDiagonal, {1, 0}, proxy);
+  EXPECT_EQ(to_vector(subdiagonal), (std::vector{0, 0, 0}));
+  EXPECT_TRUE(subdiagonal.structural_nonzeros().empty());
+
+  const auto antidiagonal =
+      tagged_random_access_range<kAntidiagonalTag, upper_storage_proxy_t, 4,
+                                 4>(kAntidiagonal, {0, 3}, proxy);
+  EXPECT_EQ(to_vector(antidiagonal), (std::vector{4, 6, 0, 0}));
+  EXPECT_EQ(to_vector(antidiagonal.structural_nonzeros()),
+            (std::vector{4, 6}));
+}
+
+TEST(banded_tagged_random_access_range, lower_stripes) {
+  const auto proxy = lower_storage_proxy_t(kPacked.data());
+
+  // 1  0  0  0
+  // 2  3  0  0
+  // 4  5  6  0
+  // 7  8  9 10
+  const auto row =
+      tagged_random_access_range<kRowTag, lower_storage_proxy_t, 4, 4>(
+          kRow, {1, 0}, proxy);
+  EXPECT_EQ(to_vector(row.structural_nonzeros()), (std::vector{2, 3}));
+
+  const auto column =
+      tagged_random_access_range<kColumnTag, lower_storage_proxy_t, 4, 4>(
+          kColumn, {0, 2}, proxy);
+  EXPECT_EQ(to_vector(column.structural_nonzeros()), (std::vector{6, 9}));
+
+  const auto antidiagonal =
+      tagged_random_access_range<kAntidiagonalTag, lower_storage_proxy_t, 4,
+                                 4>(kAntidiagonal, {1, 3}, proxy);
+  EXPECT_EQ(to_vector(antidiagonal), (std::vector{0, 6, 8}));
+  EXPECT_EQ(to_vector(antidiagonal.structural_nonzeros()),
+            (std::vector{6, 8}));
+}
+
+TEST(banded_tagged_random_access_range, tridiagonal_stripes) {
+  const auto proxy = tridiagonal_storage_proxy_t(kPacked.data());
+
+  //  2  3  0  0
+  //  4  5  6  0
+  //  0  7  8  9
+  //  0  0 10 11
+  for (std::ptrdiff_t i = 0; i < 4; ++i) {
+    const auto row =
+        tagged_random_access_range<kRowTag, tridiagonal_storage_proxy_t, 4, 4>(
+            kRow, {i, 0}, proxy);
+    const auto nonzeros = row.structural_nonzeros();
+    EXPECT_EQ(nonzeros.begin() - row.begin(),
+              std::max<std::ptrdiff_t>(i - 1, 0));
+    EXPECT_EQ(nonzeros.end() - row.begin(),
+              std::min<std::ptrdiff_t>(i + 2, 4));
+  }
+
+  const auto antidiagonal =
+      tagged_random_access_range<kAntidiagonalTag, tridiagonal_storage_proxy_t,
+                                 4, 4>(kAntidiagonal, {0, 3}, proxy);
+  EXPECT_EQ(to_vector(antidiagonal), (std::vector{0, 6, 7, 0}));
+  EXPECT_EQ(to_vector(antidiagonal.structural_nonzeros()), (std::vector{6, 7}));
+
+  const auto middle =
+      tagged_random_access_range<kAntidiagonalTag, tridiagonal_storage_proxy_t,
+                                 4, 4>(kAntidiagonal, {1, 3}, proxy);
+  EXPECT_EQ(to_vector(middle), (std::vector{0, 8, 0}));
+  EXPECT_EQ(to_vector(middle.structural_nonzeros()), (std::vector{8}));
+}
+
+TEST(banded_tagged_random_access_range, symmetric_stripes) {
+  const auto proxy =
+      packed_symmetric_storage_proxy<const int, kUpperTag, 4>(kPacked.data());
+
+  const auto row = tagged_random_access_range<
+      kRowTag, packed_symmetric_storage_proxy<const int, kUpperTag, 4>, 4, 4>(
+      kRow, {2, 0}, proxy);
+  const auto column = tagged_random_access_range<
+      kColumnTag, packed_symmetric_storage_proxy<const int, kUpperTag, 4>, 4,
+      4>(kColumn, {0, 2}, proxy);
+  EXPECT_EQ(to_vector(row), (std::vector{3, 6, 8, 9}));
+  EXPECT_EQ(to_vector(row), to_vector(column));
+}
+
+}  // namespace tests
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <span>
+
+#include "ranges/tagged_random_access_range.hpp"
+#include "storage/strided_storage_proxy.hpp"
+
+namespace tests {
+
+using namespace matrix_views::ranges;
+using namespace matrix_views::storage;
+using namespace matrix_views::utils;
+using matrix_views::utils::index;
+
+namespace {
+
+// 3x4 matrix with the value of every element equal to its offset
+auto kMatrix = [] {
+  std::array<int, 12> matrix;
+  std::iota(matrix.begin(), matrix.end(), 0);
+  return matrix;
+}();
+
+using row_major_storage_proxy_t = strided_storage_proxy<int, 4, 1>;
+using column_major_storage_proxy_t =
+    strided_storage_proxy<int, 1, std::dynamic_extent>;
+
+using row_range_t =
+    tagged_random_access_range<kRowTag, row_major_storage_proxy_t, 3, 4>;
+using column_range_t = tagged_random_access_range<kColumnTag,
+                                                  column_major_storage_proxy_t>;
+using strided_column_range_t =
+    tagged_random_access_range<kColumnTag, row_major_storage_proxy_t, 3, 4>;
+
+}  // namespace
+
+TEST(contiguous_tagged_random_access_range, enforce_concept) {
+  static_assert(std::ranges::contiguous_range<row_range_t>);
+  static_assert(std::ranges::contiguous_range<column_range_t>);
+  static_assert(std::ranges::sized_range<row_range_t>);
+
+  static_assert(!std::ranges::contiguous_range<strided_column_range_t>);
+  static_assert(std::ranges::random_access_range<strided_column_range_t>);
+  static_assert(
+      !std::ranges::contiguous_range<tagged_random_access_range<
+          kDiagonalTag, row_major_storage_proxy_t, 3, 4>>);
+}
+
+TEST(contiguous_tagged_random_access_range, data) {
+  const auto rng =
+      row_range_t(kRow, {1, 0}, row_major_storage_proxy_t(kMatrix.data()));
+
+  EXPECT_EQ(rng.data(), &kMatrix[4]);
+  EXPECT_EQ(std::ranges::data(rng), &kMatrix[4]);
+  EXPECT_EQ(std::to_address(rng.begin() + 2), &kMatrix[6]);
+  EXPECT_EQ(rng.size(), 4);
+}
+
+TEST(contiguous_tagged_random_access_range, row_span) {
+  const auto rng =
+      row_range_t(kRow, {2, 1}, row_major_storage_proxy_t(kMatrix.data()));
+  const std::span<const int> span = rng;
+
+  EXPECT_EQ(span.size(), 3);
+  EXPECT_EQ(span.data(), &kMatrix[9]);
+  EXPECT_EQ(span.back(), 11);
+}
+
+TEST(contiguous_tagged_random_access_range, column_span) {
+  const auto rng =
+      column_range_t(kColumn, {0, 2},
+                     column_major_storage_proxy_t(kMatrix.data(), 1, 3), 3, 4);
+  const std::span<const int> span = rng;
+
+  EXPECT_EQ(span.size(), 3);
+  EXPECT_EQ(span.front(), 6);
+  EXPECT_EQ(span.back(), 8);
+}
+
+TEST(contiguous_tagged_random_access_range, copy_fill) {
+  auto matrix = kMatrix;
+  const auto proxy = row_major_storage_proxy_t(matrix.data());
+  const auto source = row_range_t(kRow, {0, 0}, proxy);
+  const auto destination = row_range_t(kRow, {2, 0}, proxy);
+
+  std::ranges::copy(source, destination.begin());
+  EXPECT_TRUE(std::ranges::equal(destination, std::array{0, 1, 2, 3}));
+
+  std::ranges::fill(source, 7);
+  EXPECT_EQ(matrix[3], 7);
+  EXPECT_EQ(matrix[4], 4);
+}
+
+}  // namespace tests
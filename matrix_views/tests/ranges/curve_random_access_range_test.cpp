@@ -0,0 +1,193 @@
+#include "ranges/curve_random_access_range.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <vector>
+
+#include "matrices/matrix.hpp"
+#include "matrices/matrix_view.hpp"
+#include "storage/const_callable_storage_proxy.hpp"
+#include "storage/morton_storage_proxy.hpp"
+
+namespace tests {
+
+using namespace matrix_views::matrices;
+using namespace matrix_views::ranges;
+using namespace matrix_views::storage;
+using namespace matrix_views::utils;
+using matrix_views::utils::index;
+
+namespace {
+
+auto kRowColumnStorageProxy =
+    const_callable_storage_proxy([](index index) {
+      return static_cast<int>(10 * index.row + index.column);
+    });
+
+template <typename Tag>
+auto make_range(Tag, std::size_t rows, std::size_t columns) {
+  return curve_random_access_range(Tag{}, kRowColumnStorageProxy, rows,
+                                   columns);
+}
+
+/*
+ * Checks that the range visits every cell of the matrix exactly once and that
+ * random access agrees with the increments
+ */
+template <typename Tag>
+void expect_covers(Tag, std::size_t rows, std::size_t columns) {
+  const auto range = make_range(Tag{}, rows, columns);
+  ASSERT_EQ(range.size(), rows * columns);
+
+  auto visited = std::vector<int>(rows * columns);
+  auto n = std::ptrdiff_t(0);
+  for (auto it = range.begin(); it != range.end(); ++it, ++n) {
+    const auto cell = it.cell();
+    ASSERT_LT(cell.row, static_cast<std::ptrdiff_t>(rows));
+    ASSERT_LT(cell.column, static_cast<std::ptrdiff_t>(columns));
+    EXPECT_EQ(*it, 10 * cell.row + cell.column);
+    ++visited[static_cast<std::size_t>(cell.row) * columns +
+              static_cast<std::size_t>(cell.column)];
+
+    const auto sought = range.begin() + n;
+    EXPECT_EQ(sought.cell(), cell);
+    EXPECT_EQ((range.end() - (range.end() - sought)).cell(), cell);
+  }
+  EXPECT_TRUE(std::ranges::all_of(visited, [](int v) { return v == 1; }));
+}
+
+}  // namespace
+
+TEST(curve_random_access_range, enforce_concept) {
+  using range_t = decltype(make_range(kMorton, 1, 1));
+  static_assert(std::ranges::random_access_range<range_t>);
+  static_assert(std::ranges::sized_range<range_t>);
+  static_assert(std::ranges::view<range_t>);
+  static_assert(std::ranges::borrowed_range<range_t>);
+  static_assert(std::random_access_iterator<
+                decltype(make_range(kHilbert, 1, 1).begin())>);
+}
+
+TEST(curve_random_access_range, morton_order) {
+  EXPECT_TRUE(std::ranges::equal(
+      make_range(kMorton, 4, 4),
+      std::array{0,  1,  10, 11, 2,  3,  12, 13,
+                 20, 21, 30, 31, 22, 23, 32, 33}));
+
+  // Cells outside of a 3x3 matrix are skipped
+  EXPECT_TRUE(std::ranges::equal(
+      make_range(kMorton, 3, 3),
+      std::array{0, 1, 10, 11, 2, 12, 20, 21, 22}));
+}
+
+TEST(curve_random_access_range, hilbert_order) {
+  EXPECT_TRUE(std::ranges::equal(make_range(kHilbert, 2, 2),
+                                 std::array{0, 1, 11, 10}));
+
+  // The curve of order 2 enters the top left quadrant downwards and jumps
+  // over the cells outside of a 3x2 matrix
+  EXPECT_TRUE(std::ranges::equal(make_range(kHilbert, 3, 2),
+                                 std::array{0, 10, 11, 1, 21, 20}));
+}
+
+TEST(curve_random_access_range, coverage) {
+  for (const auto& [rows, columns] :
+       {std::pair{0, 0}, {1, 1}, {1, 9}, {9, 1}, {5, 3}, {3, 5}, {8, 8},
+        {17, 6}, {33, 31}}) {
+    expect_covers(kMorton, rows, columns);
+    expect_covers(kHilbert, rows, columns);
+  }
+}
+
+TEST(curve_random_access_range, random_access) {
+  const auto range = make_range(kHilbert, 5, 7);
+
+  EXPECT_EQ(range.end() - range.begin(), 35);
+  EXPECT_EQ(*(range.end() - 1), *std::ranges::prev(range.end()));
+  EXPECT_EQ(range[3], 10);
+  EXPECT_LT(range.begin() + 1, range.end());
+
+  auto reversed = std::vector<int>();
+  std::ranges::copy(range | std::views::reverse, std::back_inserter(reversed));
+  std::ranges::reverse(reversed);
+  EXPECT_TRUE(std::ranges::equal(reversed, range));
+}
+
+TEST(curve_random_access_range, matrix) {
+  auto m = matrix<int>(3, 5);
+  std::iota(m.data(), m.data() + m.size(), 0);
+
+  EXPECT_EQ(std::accumulate(cells(m, kMorton).begin(),
+                            cells(m, kMorton).end(), 0),
+            14 * 15 / 2);
+
+  for (auto& element : m.cells(kHilbert)) {
+    element *= 2;
+  }
+  EXPECT_EQ(m({2, 4}), 28);
+
+  const auto view = matrix_view(m.storage(), 3, 5);
+  EXPECT_TRUE(std::ranges::equal(view.cells(kMorton), m.cells(kMorton)));
+}
+
+TEST(curve_random_access_range, morton_storage_proxy) {
+  EXPECT_EQ(morton_storage_proxy<int>::size(0, 3), 0);
+  EXPECT_EQ(morton_storage_proxy<int>::size(1, 1), 1);
+  EXPECT_EQ(morton_storage_proxy<int>::size(3, 5), 32);
+  EXPECT_EQ(morton_storage_proxy<int>::size(1, 4096), 4096);
+  EXPECT_EQ(morton_storage_proxy<int>::size(4096, 3), 16384);
+
+  auto data = std::vector<int>(morton_storage_proxy<int>::size(3, 5));
+  const auto storage_proxy = morton_storage_proxy<int>(data.data(), 3, 5);
+  const auto m = matrix_view(storage_proxy, 3, 5);
+
+  m({1, 0}) = 1;
+  m({2, 3}) = 2;
+  EXPECT_EQ(data[2], 1);
+  EXPECT_EQ(data[13], 2);
+
+  // The Z-order traversal walks the memory in order
+  auto previous = static_cast<const int*>(nullptr);
+  for (auto it = m.cells(kMorton).begin(); it != m.cells(kMorton).end();
+       ++it) {
+    EXPECT_LT(previous, &*it);
+    previous = &*it;
+  }
+
+  // Rows and columns see the same elements
+  EXPECT_EQ(m.row(2)[3], 2);
+  EXPECT_EQ(m.column(0)[1], 1);
+}
+
+TEST(curve_random_access_range, morton_storage_proxy_non_square) {
+  // Stored as a row of 2x2 Z-ordered squares
+  auto data = std::vector<int>(morton_storage_proxy<int>::size(2, 9));
+  ASSERT_EQ(data.size(), 32);
+  const auto m =
+      matrix_view(morton_storage_proxy<int>(data.data(), 2, 9), 2, 9);
+  auto value = 0;
+  for (auto& element : m.cells(kMorton)) {
+    element = value++;
+  }
+
+  EXPECT_EQ(m({1, 0}), 2);
+  EXPECT_EQ(data[2], 2);
+  EXPECT_EQ(m({0, 2}), 4);
+  EXPECT_EQ(data[4], 4);
+  EXPECT_EQ(m({1, 8}), 17);
+  EXPECT_EQ(data[18], 17);
+  EXPECT_TRUE(std::ranges::equal(m.row(0), std::array{0, 1, 4, 5, 8, 9, 12,
+                                                      13, 16}));
+  EXPECT_TRUE(std::ranges::equal(m.column(7), std::array{13, 15}));
+
+  auto previous = static_cast<const int*>(nullptr);
+  for (auto& element : m.cells(kMorton)) {
+    EXPECT_LT(previous, &element);
+    previous = &element;
+  }
+}
+
+}  // namespace tests
@@ -0,0 +1,105 @@
+#include "ranges/expression.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <vector>
+
+#include "matrices/matrix.hpp"
+
+namespace tests {
+
+using namespace matrix_views::matrices;
+using namespace matrix_views::ranges;
+using namespace matrix_views::utils;
+using matrix_views::utils::index;
+
+namespace {
+
+// 3x4 matrices with the value of every element equal to 10 * row + column
+// and to its offset
+auto make_matrices() {
+  auto a = matrix<int, 3, 4>();
+  auto b = matrix<int>(3, 4);
+  for (std::ptrdiff_t i = 0; i < 3; ++i) {
+    for (std::ptrdiff_t j = 0; j < 4; ++j) {
+      a({i, j}) = static_cast<int>(10 * i + j);
+    }
+  }
+  std::iota(b.data(), b.data() + b.size(), 0);
+  return std::pair(std::move(a), std::move(b));
+}
+
+}  // namespace
+
+TEST(expression, enforce_concept) {
+  const auto [a, b] = make_matrices();
+  using expression_t = decltype(a.row(0) * 2 + b.row(0));
+  static_assert(std::ranges::random_access_range<expression_t>);
+  static_assert(std::ranges::sized_range<expression_t>);
+  static_assert(std::is_same_v<std::ranges::range_value_t<expression_t>, int>);
+  static_assert(!tagged_random_access_range_operands<decltype(a.row(0)),
+                                                     std::vector<int>>);
+}
+
+TEST(expression, arithmetic) {
+  const auto [a, b] = make_matrices();
+
+  EXPECT_TRUE(std::ranges::equal(a.row(1) + b.row(2),
+                                 std::array{18, 20, 22, 24}));
+  EXPECT_TRUE(std::ranges::equal(a.row(1) - b.row(2),
+                                 std::array{2, 2, 2, 2}));
+  EXPECT_TRUE(std::ranges::equal(a.column(1) * b.column(1),
+                                 std::array{1, 55, 189}));
+  EXPECT_TRUE(std::ranges::equal(a.column(2) / 2, std::array{1, 6, 11}));
+  EXPECT_TRUE(std::ranges::equal(-a.diagonal(0), std::array{0, -11, -22}));
+}
+
+TEST(expression, scalar_broadcast) {
+  const auto [a, b] = make_matrices();
+
+  EXPECT_TRUE(std::ranges::equal(a.row(0) * 3 + b.row(1),
+                                 std::array{4, 8, 12, 16}));
+  EXPECT_TRUE(std::ranges::equal(100 - a.row(2), std::array{80, 79, 78, 77}));
+  EXPECT_TRUE(std::ranges::equal(60 / (a.row(0) + 1),
+                                 std::array{60, 30, 20, 15}));
+}
+
+TEST(expression, map_and_zip_with) {
+  const auto [a, b] = make_matrices();
+
+  const auto squares = map(a.row(1), [](int x) { return x * x; });
+  EXPECT_TRUE(std::ranges::equal(squares, std::array{100, 121, 144, 169}));
+
+  const auto fma = zip_with([](int x, int y, int z) { return x * y + z; },
+                            a.antidiagonal(3), b.antidiagonal(3),
+                            a.antidiagonal(3));
+  EXPECT_TRUE(std::ranges::equal(fma, std::array{12, 84, 210}));
+}
+
+TEST(expression, mismatched_sizes) {
+  const auto [a, b] = make_matrices();
+  EXPECT_DEATH(a.diagonal(0) + b.diagonal(2), "");
+}
+
+TEST(expression, random_access) {
+  const auto [a, b] = make_matrices();
+  const auto expression = a.row(2) * 2 + b.row(0);
+
+  EXPECT_EQ(expression.size(), 4);
+  EXPECT_EQ(expression[3], 49);
+  EXPECT_EQ(*(expression.end() - 2), 46);
+  EXPECT_EQ(expression.rbegin()[0], 49);
+}
+
+TEST(expression, assignment) {
+  auto [a, b] = make_matrices();
+  std::ranges::copy(a.row(1) * 2 + b.row(1), b.row(1).begin());
+
+  EXPECT_TRUE(std::ranges::equal(b.row(1), std::array{24, 27, 30, 33}));
+  EXPECT_TRUE(std::ranges::equal(b.row(0), std::array{0, 1, 2, 3}));
+}
+
+}  // namespace tests
@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include "matrices/matrix.hpp"
+#include "matrices/matrix_view.hpp"
+#include "ranges/tagged_random_access_range.hpp"
+#include "storage/const_callable_storage_proxy.hpp"
+#include "storage/strided_storage_proxy.hpp"
+
+namespace tests {
+
+using namespace matrix_views::matrices;
+using namespace matrix_views::ranges;
+using namespace matrix_views::storage;
+using namespace matrix_views::utils;
+using matrix_views::utils::index;
+
+namespace {
+
+// 5x7 matrix with the value of every element equal to its offset
+auto kMatrix = [] {
+  std::array<int, 35> matrix;
+  std::iota(matrix.begin(), matrix.end(), 0);
+  return matrix;
+}();
+
+using storage_proxy_t = strided_storage_proxy<int, 7, 1>;
+
+template <typename Tag, typename Index>
+using range_t =
+    tagged_random_access_range<Tag, storage_proxy_t, 5, 7, 1, Index>;
+
+auto kRowColumnStorageProxy =
+    const_callable_storage_proxy([](index index) {
+      return static_cast<std::int64_t>(100000 * index.row + index.column);
+    });
+
+template <typename Tag, typename Index>
+void expect_same_as_wide(Tag, index origin) {
+  const auto storage_proxy = storage_proxy_t(kMatrix.data());
+  const auto narrow = range_t<Tag, Index>(Tag{}, origin, storage_proxy);
+  const auto wide = range_t<Tag, std::ptrdiff_t>(Tag{}, origin, storage_proxy);
+
+  EXPECT_EQ(narrow.size(), wide.size());
+  EXPECT_TRUE(std::ranges::equal(narrow, wide));
+  EXPECT_TRUE(std::ranges::equal(narrow | std::views::reverse,
+                                 wide | std::views::reverse));
+  EXPECT_EQ(narrow.origin(), origin);
+}
+
+}  // namespace
+
+TEST(narrow_index_tagged_random_access_range, default_index) {
+  static_assert(std::is_same_v<default_index_t<5, 7>, std::int32_t>);
+  static_assert(std::is_same_v<default_index_t<std::dynamic_extent, 7>,
+                               std::ptrdiff_t>);
+  static_assert(std::is_same_v<default_index_t<std::size_t(1) << 32, 7>,
+                               std::ptrdiff_t>);
+}
+
+TEST(narrow_index_tagged_random_access_range, conversions) {
+  // Only widening conversions are implicit
+  static_assert(std::is_convertible_v<basic_index<std::int32_t>, index>);
+  static_assert(
+      std::is_convertible_v<basic_index<std::uint16_t>, basic_index<int>>);
+  static_assert(!std::is_convertible_v<index, basic_index<std::int32_t>>);
+  static_assert(
+      !std::is_convertible_v<basic_index<int>, basic_index<std::uint32_t>>);
+  static_assert(std::is_constructible_v<basic_index<std::int32_t>, index>);
+
+  EXPECT_EQ(static_cast<basic_index<std::int16_t>>(index{-3, 4}),
+            (basic_index<std::int16_t>{-3, 4}));
+
+  // The origin of a range must fit into its index type
+  const auto storage_proxy = storage_proxy_t(kMatrix.data());
+  EXPECT_DEATH((range_t<kRowTag, std::int8_t>(kRow, {300, 0}, storage_proxy)),
+               "");
+}
+
+TEST(narrow_index_tagged_random_access_range, matrices) {
+  using narrow_t = matrix<int, std::dynamic_extent, std::dynamic_extent,
+                          kRowMajorTag, std::int32_t>;
+  static_assert(std::is_same_v<matrix<int, 5, 7>::index_type, std::int32_t>);
+  static_assert(std::is_same_v<matrix<int>::index_type, std::ptrdiff_t>);
+  static_assert(sizeof(std::declval<narrow_t&>().row(0).begin()) <
+                sizeof(std::declval<matrix<int>&>().row(0).begin()));
+  static_assert(
+      std::is_same_v<decltype(*std::declval<narrow_t&>().stripes(kColumn)
+                                  .begin()),
+                     narrow_t::range<kColumnTag>>);
+
+  auto m = narrow_t(5, 7);
+  std::iota(m.data(), m.data() + m.size(), 0);
+  EXPECT_TRUE(std::ranges::equal(m.column(3), std::array{3, 10, 17, 24, 31}));
+  EXPECT_TRUE(std::ranges::equal(*(rows(m).begin() + 4),
+                                 std::array{28, 29, 30, 31, 32, 33, 34}));
+
+  const auto view = matrix_view<decltype(m.storage()), 5, 7, std::int16_t>(
+      m.storage(), 5, 7);
+  EXPECT_TRUE(std::ranges::equal(view.antidiagonal(6), m.antidiagonal(6)));
+  EXPECT_TRUE(std::ranges::equal(*diagonals(view).begin(), std::array{28}));
+}
+
+TEST(narrow_index_tagged_random_access_range, sizeof) {
+  static_assert(sizeof(range_t<kRowTag, std::int32_t>().begin()) ==
+                sizeof(int*) + 2 * sizeof(std::int32_t));
+  static_assert(sizeof(range_t<kRowTag, std::uint16_t>().begin()) <
+                sizeof(range_t<kRowTag, std::int64_t>().begin()));
+  static_assert(sizeof(basic_index<std::uint16_t>) == 4);
+}
+
+TEST(narrow_index_tagged_random_access_range, directions) {
+  expect_same_as_wide<kRowTag, std::int32_t>(kRow, {2, 1});
+  expect_same_as_wide<kColumnTag, std::int32_t>(kColumn, {1, 3});
+  expect_same_as_wide<kDiagonalTag, std::int32_t>(kDiagonal, {0, 2});
+  expect_same_as_wide<kAntidiagonalTag, std::int32_t>(kAntidiagonal, {1, 6});
+
+  // Unsigned columns of antidiagonals wrap past the first column at the end
+  // only, where the distance is taken from the rows
+  expect_same_as_wide<kRowTag, std::uint16_t>(kRow, {4, 0});
+  expect_same_as_wide<kColumnTag, std::uint16_t>(kColumn, {0, 6});
+  expect_same_as_wide<kDiagonalTag, std::uint16_t>(kDiagonal, {2, 0});
+  expect_same_as_wide<kAntidiagonalTag, std::uint16_t>(kAntidiagonal,
+                                                       {0, 4});
+}
+
+TEST(narrow_index_tagged_random_access_range, distances) {
+  // Distances over the whole range of the index type do not overflow
+  using row_t =
+      tagged_random_access_range<kRowTag, decltype(kRowColumnStorageProxy),
+                                 std::dynamic_extent, std::dynamic_extent, 1,
+                                 std::uint16_t>;
+  const auto row = row_t(kRow, {3, 0}, kRowColumnStorageProxy, 4, 65535);
+
+  EXPECT_EQ(row.ssize(), 65535);
+  EXPECT_EQ(row.begin() - row.end(), -65535);
+  EXPECT_EQ(row[65534], 365534);
+  EXPECT_EQ(*(row.end() - 1), 365534);
+  EXPECT_LT(row.begin(), row.end());
+
+  const auto stepped = stride<3>(row);
+  EXPECT_EQ(stepped.ssize(), 21845);
+  EXPECT_EQ(stepped[21844], 300000 + 3 * 21844);
+}
+
+}  // namespace tests
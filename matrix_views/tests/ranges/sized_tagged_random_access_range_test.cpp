@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <ranges>
+
+#include "ranges/tagged_random_access_range.hpp"
+#include "storage/const_callable_storage_proxy.hpp"
+#include "storage/strided_storage_proxy.hpp"
+
+namespace tests {
+
+using namespace matrix_views::iterators;
+using namespace matrix_views::ranges;
+using namespace matrix_views::storage;
+using namespace matrix_views::utils;
+using matrix_views::utils::index;
+
+namespace {
+
+// 5x7 matrix with the value of every element equal to its offset
+auto kMatrix = [] {
+  std::array<int, 35> matrix;
+  std::iota(matrix.begin(), matrix.end(), 0);
+  return matrix;
+}();
+
+using storage_proxy_t = strided_storage_proxy<int, 7, 1>;
+
+template <typename Tag>
+using range_t = tagged_random_access_range<Tag, storage_proxy_t>;
+
+/*
+ * Callable that counts its copies
+ */
+struct counting_callable final {
+  static inline int copies = 0;
+
+  counting_callable() = default;
+  counting_callable(const counting_callable&) { ++copies; }
+  counting_callable(counting_callable&&) = default;
+  counting_callable& operator=(const counting_callable&) = default;
+  counting_callable& operator=(counting_callable&&) = default;
+
+  int operator()(index index) const {
+    return static_cast<int>(10 * index.row + index.column);
+  }
+};
+
+template <typename Tag>
+void expect_closed_form_size(Tag, index origin, std::size_t step) {
+  const auto range = stride(
+      range_t<Tag>(Tag{}, origin, storage_proxy_t(kMatrix.data()), 5, 7),
+      step);
+
+  EXPECT_EQ(range.ssize(), std::distance(range.begin(), range.end()));
+  EXPECT_EQ(range.sentinel() - range.begin(), range.ssize());
+  EXPECT_EQ(range.begin() + range.ssize(), range.sentinel());
+  EXPECT_EQ(range.end(), range.sentinel());
+}
+
+}  // namespace
+
+TEST(sized_tagged_random_access_range, enforce_concept) {
+  using range = range_t<kRowTag>;
+  static_assert(std::ranges::view<range>);
+  static_assert(std::ranges::sized_range<range>);
+  static_assert(std::ranges::borrowed_range<range>);
+  static_assert(std::ranges::common_range<range>);
+  static_assert(std::sized_sentinel_for<decltype(range().sentinel()),
+                                        decltype(range().begin())>);
+  static_assert(sizeof(range().sentinel()) == sizeof(std::ptrdiff_t));
+
+  using subrange =
+      decltype(std::ranges::subrange(range().begin(), range().sentinel()));
+  static_assert(std::ranges::view<subrange>);
+  static_assert(std::ranges::sized_range<subrange>);
+  static_assert(std::ranges::contiguous_range<subrange>);
+}
+
+TEST(sized_tagged_random_access_range, closed_form_size) {
+  for (const std::size_t step : {1, 2, 3, 8}) {
+    expect_closed_form_size(kRow, {2, 0}, step);
+    expect_closed_form_size(kRow, {4, 6}, step);
+    expect_closed_form_size(kColumn, {0, 3}, step);
+    expect_closed_form_size(kColumn, {3, 6}, step);
+    expect_closed_form_size(kDiagonal, {0, 2}, step);
+    expect_closed_form_size(kDiagonal, {3, 0}, step);
+    expect_closed_form_size(kAntidiagonal, {0, 6}, step);
+    expect_closed_form_size(kAntidiagonal, {1, 6}, step);
+  }
+}
+
+TEST(sized_tagged_random_access_range, sentinel) {
+  const auto column =
+      range_t<kColumnTag>(kColumn, {1, 2}, storage_proxy_t(kMatrix.data()), 5,
+                          7);
+
+  auto sum = 0;
+  for (auto it = column.begin(); it != column.sentinel(); ++it) {
+    sum += *it;
+  }
+  EXPECT_EQ(sum, 9 + 16 + 23 + 30);
+
+  const auto subrange =
+      std::ranges::subrange(column.begin(), column.sentinel());
+  EXPECT_EQ(subrange.size(), 4);
+  EXPECT_TRUE(std::ranges::equal(subrange, std::array{9, 16, 23, 30}));
+  EXPECT_EQ(std::ranges::find(column.begin(), column.sentinel(), 23) -
+                column.begin(),
+            2);
+}
+
+TEST(sized_tagged_random_access_range, no_storage_proxy_copies) {
+  const auto row = tagged_random_access_range(
+      kRow, {1, 2}, const_callable_storage_proxy(counting_callable()), 3, 6);
+
+  counting_callable::copies = 0;
+  EXPECT_EQ(row.size(), 4);
+  EXPECT_EQ(std::ranges::size(row), 4);
+  EXPECT_FALSE(row.empty());
+  EXPECT_EQ(row.sentinel().position(), 6);
+  EXPECT_EQ(counting_callable::copies, 0);
+
+  // Building end() copies the storage proxy once
+  const auto end = row.end();
+  EXPECT_EQ(counting_callable::copies, 1);
+  EXPECT_EQ(end[-1], 15);
+}
+
+}  // namespace tests
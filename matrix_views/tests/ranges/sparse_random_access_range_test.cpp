@@ -0,0 +1,67 @@
+#include "ranges/sparse_random_access_range.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <ranges>
+
+#include "ranges/tagged_random_access_range.hpp"
+#include "storage/compressed_storage_proxy.hpp"
+
+namespace tests {
+
+using namespace matrix_views::ranges;
+using namespace matrix_views::storage;
+using namespace matrix_views::utils;
+using matrix_views::utils::index;
+
+namespace {
+
+// 3 x 4 matrix
+// 0 1 0 2
+// 0 0 0 0
+// 3 0 4 0
+constexpr auto kOffsets = std::array<std::ptrdiff_t, 4>{0, 2, 2, 4};
+constexpr auto kIndices = std::array<std::ptrdiff_t, 4>{1, 3, 0, 2};
+constexpr auto kValues = std::array{1, 2, 3, 4};
+
+const auto kStorageProxy = compressed_storage_proxy<int>(
+    kOffsets.data(), kIndices.data(), kValues.data());
+
+using storage_proxy_t = std::remove_const_t<decltype(kStorageProxy)>;
+
+}  // namespace
+
+TEST(sparse_random_access_range, enforce_concept) {
+  static_assert(std::ranges::random_access_range<
+                sparse_random_access_range<kRowTag, storage_proxy_t>>);
+  static_assert(std::random_access_iterator<decltype(
+                    sparse_random_access_range<kRowTag, storage_proxy_t>()
+                        .begin())>);
+}
+
+TEST(sparse_random_access_range, nonzeros) {
+  const auto row = sparse_random_access_range<kRowTag, storage_proxy_t>(
+      kRow, {2, 0}, kStorageProxy);
+
+  EXPECT_EQ(std::size(row), 2);
+  EXPECT_EQ(row[0], (std::pair{index{2, 0}, 3}));
+  EXPECT_EQ(*std::rbegin(row), (std::pair{index{2, 2}, 4}));
+
+  EXPECT_TRUE(std::empty(sparse_random_access_range<kRowTag, storage_proxy_t>(
+      kRow, {1, 0}, kStorageProxy)));
+}
+
+TEST(sparse_random_access_range, matches_dense_view) {
+  for (std::ptrdiff_t i = 0; i < 3; ++i) {
+    const auto dense = tagged_random_access_range<kRowTag, storage_proxy_t>(
+        kRow, {i, 0}, kStorageProxy, 3, 4);
+    for (const auto [index, value] :
+         sparse_random_access_range<kRowTag, storage_proxy_t>(kRow, {i, 0},
+                                                              kStorageProxy)) {
+      EXPECT_EQ(dense[index.column], value);
+    }
+  }
+}
+
+}  // namespace tests
@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <span>
+
+#include "kernels/reduce.hpp"
+#include "ranges/expression.hpp"
+#include "ranges/tagged_random_access_range.hpp"
+#include "storage/const_callable_storage_proxy.hpp"
+#include "storage/strided_storage_proxy.hpp"
+
+namespace tests {
+
+using namespace matrix_views::ranges;
+using namespace matrix_views::storage;
+using namespace matrix_views::utils;
+using matrix_views::utils::index;
+
+namespace {
+
+// 5x7 matrix with the value of every element equal to its offset
+auto kMatrix = [] {
+  std::array<int, 35> matrix;
+  std::iota(matrix.begin(), matrix.end(), 0);
+  return matrix;
+}();
+
+using storage_proxy_t = strided_storage_proxy<int, 7, 1>;
+
+template <typename Tag>
+using range_t = tagged_random_access_range<Tag, storage_proxy_t, 5, 7>;
+
+auto kRowColumnStorageProxy =
+    const_callable_storage_proxy([](index index) {
+      return static_cast<int>(10 * index.row + index.column);
+    });
+
+}  // namespace
+
+TEST(stepped_tagged_random_access_range, enforce_concept) {
+  using row_t = decltype(stride<2>(range_t<kRowTag>()));
+  static_assert(std::ranges::random_access_range<row_t>);
+  static_assert(std::ranges::sized_range<row_t>);
+  static_assert(!std::ranges::contiguous_range<row_t>);
+  static_assert(std::ranges::contiguous_range<range_t<kRowTag>>);
+
+  static_assert(kStaticSizeOf<row_t> == 4);
+  static_assert(kStaticSizeOf<decltype(stride<2>(range_t<kColumnTag>()))> ==
+                3);
+  static_assert(kStaticSizeOf<decltype(stride(range_t<kRowTag>(), 2))> ==
+                std::dynamic_extent);
+
+  // Static steps live in the type only
+  static_assert(sizeof(row_t) == sizeof(range_t<kRowTag>));
+  static_assert(sizeof(row_t().begin()) == sizeof(range_t<kRowTag>().begin()));
+}
+
+TEST(stepped_tagged_random_access_range, directions) {
+  const auto storage_proxy = storage_proxy_t(kMatrix.data());
+
+  const auto row = stride<3>(range_t<kRowTag>(kRow, {1, 0}, storage_proxy));
+  EXPECT_EQ(row.size(), 3);
+  EXPECT_TRUE(std::ranges::equal(row, std::array{7, 10, 13}));
+
+  const auto column =
+      stride(range_t<kColumnTag>(kColumn, {1, 2}, storage_proxy), 2);
+  EXPECT_EQ(column.size(), 2);
+  EXPECT_TRUE(std::ranges::equal(column, std::array{9, 23}));
+
+  const auto diagonal =
+      stride<2>(range_t<kDiagonalTag>(kDiagonal, {0, 1}, storage_proxy));
+  EXPECT_TRUE(std::ranges::equal(diagonal, std::array{1, 17, 33}));
+
+  const auto antidiagonal = stride<2>(
+      range_t<kAntidiagonalTag>(kAntidiagonal, {0, 4}, storage_proxy));
+  EXPECT_TRUE(std::ranges::equal(antidiagonal, std::array{4, 16, 28}));
+
+  // Steps longer than the range leave its first element only
+  EXPECT_TRUE(std::ranges::equal(
+      stride<9>(range_t<kRowTag>(kRow, {4, 0}, storage_proxy)),
+      std::array{28}));
+}
+
+TEST(stepped_tagged_random_access_range, random_access) {
+  const auto row = stride<2>(
+      range_t<kRowTag>(kRow, {2, 0}, storage_proxy_t(kMatrix.data())));
+
+  EXPECT_EQ(row[3], 20);
+  EXPECT_EQ(*(row.end() - 1), 20);
+  EXPECT_EQ(*(row.begin() + 2), 18);
+  EXPECT_EQ(row.end() - row.begin(), 4);
+  EXPECT_EQ(row.begin().stride(), 2);
+  EXPECT_LT(row.begin() + 1, row.end());
+
+  auto reversed = std::array<int, 4>();
+  std::ranges::copy(row | std::views::reverse, reversed.begin());
+  EXPECT_EQ(reversed, (std::array{20, 18, 16, 14}));
+}
+
+TEST(stepped_tagged_random_access_range, nested) {
+  const auto column = range_t<kColumnTag>(kColumn, {0, 6},
+                                          storage_proxy_t(kMatrix.data()));
+
+  const auto every_fourth = stride<2>(stride<2>(column));
+  static_assert(std::is_same_v<std::remove_const_t<decltype(every_fourth)>,
+                               decltype(stride<4>(column))>);
+  EXPECT_TRUE(std::ranges::equal(every_fourth, std::array{6, 34}));
+  EXPECT_EQ(stride(stride<2>(column), 2).step(), 4);
+}
+
+TEST(stepped_tagged_random_access_range, callable_storage_proxy) {
+  const auto row = stride<3>(tagged_random_access_range(
+      kRow, {2, 1}, kRowColumnStorageProxy, 5, 7));
+  EXPECT_TRUE(std::ranges::equal(row, std::array{21, 24}));
+}
+
+TEST(stepped_tagged_random_access_range, kernels_and_expressions) {
+  const auto storage_proxy = storage_proxy_t(kMatrix.data());
+  const auto even = stride<2>(range_t<kRowTag>(kRow, {3, 0}, storage_proxy));
+  const auto other = stride<2>(range_t<kRowTag>(kRow, {1, 0}, storage_proxy));
+
+  EXPECT_EQ(matrix_views::kernels::sum(even), 21 + 23 + 25 + 27);
+  EXPECT_TRUE(std::ranges::equal(even - other, std::array{14, 14, 14, 14}));
+
+  // Operands of expressions must take the same step
+  const auto row = range_t<kRowTag>(kRow, {1, 0}, storage_proxy);
+  static_assert(!tagged_random_access_range_zippable<
+                decltype(even), decltype(stride<3>(row))>);
+  EXPECT_DEATH(even - stride(row, 3), "");
+}
+
+TEST(stepped_tagged_random_access_range, zero_step) {
+  const auto row =
+      range_t<kRowTag>(kRow, {1, 0}, storage_proxy_t(kMatrix.data()));
+  EXPECT_DEATH(stride(row, 0), "");
+}
+
+}  // namespace tests
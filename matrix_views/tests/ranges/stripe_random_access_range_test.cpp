@@ -0,0 +1,101 @@
+#include "ranges/stripe_random_access_range.hpp"
+
+#include <gtest/gtest.h>
+
+#include <ranges>
+
+#include "storage/const_callable_storage_proxy.hpp"
+
+namespace tests {
+
+using namespace matrix_views::ranges;
+using namespace matrix_views::storage;
+using namespace matrix_views::utils;
+using matrix_views::utils::index;
+
+namespace {
+
+auto kEchoIndex = index{};
+auto kEchoStorageProxy = const_callable_storage_proxy(
+    [](index idx) -> index& { return kEchoIndex = idx; });
+
+template <typename Tag>
+using mock_dynamic_stripe_random_access_range_t =
+    stripe_random_access_range<Tag, decltype(kEchoStorageProxy)>;
+
+template <typename Tag>
+using mock_static_stripe_random_access_range_t =
+    stripe_random_access_range<Tag, decltype(kEchoStorageProxy), 3, 4>;
+
+}  // namespace
+
+TEST(stripe_random_access_range, enforce_concept) {
+  static_assert(std::ranges::random_access_range<
+                mock_dynamic_stripe_random_access_range_t<kRowTag>>);
+  static_assert(std::ranges::view<
+                mock_static_stripe_random_access_range_t<kDiagonalTag>>);
+  static_assert(std::ranges::borrowed_range<
+                mock_static_stripe_random_access_range_t<kColumnTag>>);
+}
+
+TEST(stripe_random_access_range, size) {
+  EXPECT_EQ(std::size(mock_static_stripe_random_access_range_t<kRowTag>(
+                kRow, kEchoStorageProxy)),
+            3);
+  EXPECT_EQ(std::size(mock_dynamic_stripe_random_access_range_t<kColumnTag>(
+                kColumn, kEchoStorageProxy, 3, 4)),
+            4);
+  EXPECT_EQ(std::size(mock_static_stripe_random_access_range_t<kDiagonalTag>(
+                kDiagonal, kEchoStorageProxy)),
+            6);
+  EXPECT_EQ(
+      std::size(mock_dynamic_stripe_random_access_range_t<kAntidiagonalTag>(
+          kAntidiagonal, kEchoStorageProxy, 3, 4)),
+      6);
+  EXPECT_TRUE(std::empty(mock_dynamic_stripe_random_access_range_t<
+                         kDiagonalTag>(kDiagonal, kEchoStorageProxy, 0, 0)));
+}
+
+TEST(stripe_random_access_range, covers_matrix) {
+  const auto count = [](auto&& stripes) {
+    std::size_t count = 0;
+    for (auto stripe : stripes) {
+      count += std::size(stripe);
+    }
+    return count;
+  };
+
+  EXPECT_EQ(count(mock_static_stripe_random_access_range_t<kRowTag>(
+                kRow, kEchoStorageProxy)),
+            12);
+  EXPECT_EQ(count(mock_static_stripe_random_access_range_t<kColumnTag>(
+                kColumn, kEchoStorageProxy)),
+            12);
+  EXPECT_EQ(count(mock_dynamic_stripe_random_access_range_t<kDiagonalTag>(
+                kDiagonal, kEchoStorageProxy, 3, 4)),
+            12);
+  EXPECT_EQ(count(mock_dynamic_stripe_random_access_range_t<kAntidiagonalTag>(
+                kAntidiagonal, kEchoStorageProxy, 3, 4)),
+            12);
+}
+
+TEST(stripe_random_access_range, begin_end) {
+  const auto rng = mock_static_stripe_random_access_range_t<kDiagonalTag>(
+      kDiagonal, kEchoStorageProxy);
+
+  EXPECT_EQ(*(*std::begin(rng)).begin(), (index{2, 0}));
+  EXPECT_EQ(*(*std::rbegin(rng)).begin(), (index{0, 3}));
+}
+
+TEST(stripe_random_access_range, compose) {
+  auto starts = mock_static_stripe_random_access_range_t<kColumnTag>(
+                    kColumn, kEchoStorageProxy) |
+                std::views::drop(1) | std::views::transform([](auto stripe) {
+                  return *stripe.begin();
+                });
+
+  EXPECT_EQ(std::ranges::distance(starts), 3);
+  EXPECT_EQ(*starts.begin(), (index{0, 1}));
+}
+
+}  // namespace tests
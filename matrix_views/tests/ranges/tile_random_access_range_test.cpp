@@ -0,0 +1,82 @@
+#include "ranges/tile_random_access_range.hpp"
+
+#include <gtest/gtest.h>
+
+#include <ranges>
+
+#include "storage/const_callable_storage_proxy.hpp"
+
+namespace tests {
+
+using namespace matrix_views::ranges;
+using namespace matrix_views::storage;
+using namespace matrix_views::utils;
+using matrix_views::utils::index;
+
+namespace {
+
+auto kEchoIndex = index{};
+auto kEchoStorageProxy = const_callable_storage_proxy(
+    [](index idx) -> index& { return kEchoIndex = idx; });
+
+using mock_dynamic_tile_random_access_range_t =
+    tile_random_access_range<decltype(kEchoStorageProxy)>;
+using mock_static_tile_random_access_range_t =
+    tile_random_access_range<decltype(kEchoStorageProxy), 3, 5, 7>;
+
+}  // namespace
+
+TEST(tile_random_access_range, enforce_concept) {
+  static_assert(std::ranges::random_access_range<
+                mock_dynamic_tile_random_access_range_t>);
+  static_assert(
+      std::ranges::view<mock_static_tile_random_access_range_t>);
+  static_assert(std::ranges::borrowed_range<
+                mock_static_tile_random_access_range_t>);
+}
+
+TEST(tile_random_access_range, size) {
+  EXPECT_EQ(std::size(mock_static_tile_random_access_range_t(
+                kTile, kEchoStorageProxy)),
+            6);
+  EXPECT_EQ(std::size(mock_dynamic_tile_random_access_range_t(
+                kTile, kEchoStorageProxy, 2, 4, 4)),
+            4);
+  EXPECT_EQ(std::size(mock_dynamic_tile_random_access_range_t(
+                kTile, kEchoStorageProxy, 8, 5, 7)),
+            1);
+  EXPECT_TRUE(std::empty(mock_dynamic_tile_random_access_range_t(
+      kTile, kEchoStorageProxy, 3, 0, 7)));
+  EXPECT_DEATH((mock_dynamic_tile_random_access_range_t(
+                   kTile, kEchoStorageProxy, 0, 5, 7)),
+               "");
+}
+
+TEST(tile_random_access_range, covers_matrix) {
+  std::size_t count = 0;
+  std::ptrdiff_t checksum = 0;
+  for (auto tile :
+       mock_dynamic_tile_random_access_range_t(kTile, kEchoStorageProxy, 3,
+                                               5, 7)) {
+    for (auto row : tile) {
+      for (const auto idx : row) {
+        checksum += idx.row * 7 + idx.column;
+        ++count;
+      }
+    }
+  }
+  EXPECT_EQ(count, 35);
+  EXPECT_EQ(checksum, 34 * 35 / 2);
+}
+
+TEST(tile_random_access_range, begin_end) {
+  const auto rng =
+      mock_static_tile_random_access_range_t(kTile, kEchoStorageProxy);
+
+  EXPECT_EQ((*std::begin(rng))({0, 0}), (index{0, 0}));
+  EXPECT_EQ((*std::rbegin(rng))({0, 0}), (index{3, 6}));
+  EXPECT_EQ((*std::rbegin(rng)).rows(), 2);
+  EXPECT_EQ((*std::rbegin(rng)).columns(), 1);
+}
+
+}  // namespace tests
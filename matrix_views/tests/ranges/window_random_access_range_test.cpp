@@ -0,0 +1,84 @@
+#include "ranges/window_random_access_range.hpp"
+
+#include <gtest/gtest.h>
+
+#include "storage/const_callable_storage_proxy.hpp"
+
+namespace tests {
+
+using namespace matrix_views::ranges;
+using namespace matrix_views::storage;
+using namespace matrix_views::utils;
+using matrix_views::utils::index;
+
+namespace {
+
+auto kEchoIndex = index{};
+auto kEchoStorageProxy = const_callable_storage_proxy(
+    [](index idx) -> index& { return kEchoIndex = idx; });
+
+using mock_dynamic_window_random_access_range_t =
+    window_random_access_range<decltype(kEchoStorageProxy)>;
+using mock_static_window_random_access_range_t =
+    window_random_access_range<decltype(kEchoStorageProxy), 2, 3>;
+
+}  // namespace
+
+TEST(window_random_access_range, enforce_concept) {
+  static_assert(std::ranges::random_access_range<
+                mock_dynamic_window_random_access_range_t>);
+  static_assert(
+      std::ranges::view<mock_static_window_random_access_range_t>);
+  static_assert(std::ranges::random_access_range<decltype(
+                    mock_static_window_random_access_range_t().stripes(
+                        kColumn))>);
+}
+
+TEST(window_random_access_range, access) {
+  const auto window =
+      mock_static_window_random_access_range_t({1, 2}, kEchoStorageProxy);
+
+  EXPECT_EQ(window.rows(), 2);
+  EXPECT_EQ(window.columns(), 3);
+  EXPECT_EQ(window({0, 0}), (index{1, 2}));
+  EXPECT_EQ(window({1, 2}), (index{2, 4}));
+}
+
+TEST(window_random_access_range, rows) {
+  const auto window = mock_dynamic_window_random_access_range_t(
+      {1, 2}, kEchoStorageProxy, 2, 3);
+
+  EXPECT_EQ(std::size(window), 2);
+  EXPECT_EQ(std::size(window[0]), 3);
+  EXPECT_EQ(*window[1].begin(), (index{2, 2}));
+  EXPECT_EQ(*std::prev(window[1].end()), (index{2, 4}));
+}
+
+TEST(window_random_access_range, columns) {
+  const auto columns = mock_dynamic_window_random_access_range_t(
+                           {1, 2}, kEchoStorageProxy, 2, 3)
+                           .stripes(kColumn);
+
+  EXPECT_EQ(std::size(columns), 3);
+  EXPECT_EQ(std::size(columns[0]), 2);
+  EXPECT_EQ(*columns[2].begin(), (index{1, 4}));
+  EXPECT_EQ(*std::prev(columns[2].end()), (index{2, 4}));
+}
+
+TEST(window_random_access_range, covers_window) {
+  std::size_t count = 0;
+  for (auto row :
+       mock_dynamic_window_random_access_range_t({3, 1}, kEchoStorageProxy,
+                                                 4, 5)) {
+    for (const auto idx : row) {
+      EXPECT_GE(idx.row, 3);
+      EXPECT_LT(idx.row, 7);
+      EXPECT_GE(idx.column, 1);
+      EXPECT_LT(idx.column, 6);
+      ++count;
+    }
+  }
+  EXPECT_EQ(count, 20);
+}
+
+}  // namespace tests
@@ -0,0 +1,58 @@
+#include "storage/callable_storage_proxy.hpp"
+
+#include <gtest/gtest.h>
+
+#include "iterators/tagged_random_access_iterator.hpp"
+#include "storage/const_callable_storage_proxy.hpp"
+
+namespace tests {
+
+using namespace matrix_views::iterators;
+using namespace matrix_views::storage;
+using namespace matrix_views::utils;
+using matrix_views::utils::index;
+
+namespace {
+
+auto kEchoStorageProxy =
+    callable_storage_proxy([](index idx) { return idx.row + idx.column; });
+
+int kValue = 42;
+auto kCapturingStorageProxy =
+    const_callable_storage_proxy([value = &kValue](index) -> int& {
+      return *value;
+    });
+
+}  // namespace
+
+TEST(callable_storage_proxy, empty_callable_sizeof) {
+  static_assert(std::is_empty_v<decltype(kEchoStorageProxy)>);
+  static_assert(
+      sizeof(tagged_random_access_iterator<kRowTag,
+                                           decltype(kEchoStorageProxy)>) ==
+      sizeof(index));
+}
+
+TEST(callable_storage_proxy, capturing_callable_sizeof) {
+  static_assert(sizeof(kCapturingStorageProxy) == sizeof(int*));
+}
+
+TEST(callable_storage_proxy, call_operator) {
+  EXPECT_EQ(kEchoStorageProxy({1, 2}), 3);
+  EXPECT_EQ(kCapturingStorageProxy({1, 2}), 42);
+}
+
+TEST(callable_storage_proxy, capturing_callable_iterator) {
+  static_assert(std::random_access_iterator<tagged_random_access_iterator<
+                    kColumnTag, decltype(kCapturingStorageProxy)>>);
+
+  auto it1 = tagged_random_access_iterator<kColumnTag,
+                                           decltype(kCapturingStorageProxy)>();
+  const auto it2 = tagged_random_access_iterator(
+      kColumn, {0, 0}, decltype(kCapturingStorageProxy)(kCapturingStorageProxy));
+
+  it1 = it2;
+  EXPECT_EQ(&*it1, &kValue);
+}
+
+}  // namespace tests
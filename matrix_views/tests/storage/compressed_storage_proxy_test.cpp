@@ -0,0 +1,63 @@
+#include "storage/compressed_storage_proxy.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+
+namespace tests {
+
+using namespace matrix_views::storage;
+using namespace matrix_views::utils;
+using matrix_views::utils::index;
+
+namespace {
+
+// 3 x 4 matrix
+// 0 1 0 2
+// 0 0 0 0
+// 3 0 4 0
+constexpr auto kOffsets = std::array<std::ptrdiff_t, 4>{0, 2, 2, 4};
+constexpr auto kIndices = std::array<std::ptrdiff_t, 4>{1, 3, 0, 2};
+constexpr auto kValues = std::array{1, 2, 3, 4};
+
+// Same matrix compressed by columns
+constexpr auto kColumnOffsets = std::array<std::ptrdiff_t, 5>{0, 1, 2, 3, 4};
+constexpr auto kColumnIndices = std::array<std::ptrdiff_t, 4>{2, 0, 2, 0};
+constexpr auto kColumnValues = std::array{3, 1, 4, 2};
+
+}  // namespace
+
+TEST(compressed_storage_proxy, csr) {
+  const auto proxy = compressed_storage_proxy<int>(
+      kOffsets.data(), kIndices.data(), kValues.data());
+
+  EXPECT_EQ(proxy({0, 1}), 1);
+  EXPECT_EQ(proxy({0, 2}), 0);
+  EXPECT_EQ(proxy({1, 3}), 0);
+  EXPECT_EQ(proxy({2, 2}), 4);
+
+  EXPECT_EQ(proxy.first(2), 2);
+  EXPECT_EQ(proxy.last(2), 4);
+  EXPECT_EQ(proxy.index(2, 3), (index{2, 2}));
+  EXPECT_EQ(proxy.value(3), 4);
+
+  static_assert(decltype(proxy)::compressed(kRow));
+  static_assert(!decltype(proxy)::compressed(kColumn));
+}
+
+TEST(compressed_storage_proxy, csc) {
+  const auto proxy = compressed_storage_proxy<int, kColumnMajorTag>(
+      kColumnOffsets.data(), kColumnIndices.data(), kColumnValues.data());
+
+  EXPECT_EQ(proxy({0, 1}), 1);
+  EXPECT_EQ(proxy({0, 2}), 0);
+  EXPECT_EQ(proxy({0, 3}), 2);
+  EXPECT_EQ(proxy({2, 0}), 3);
+
+  EXPECT_EQ(proxy.index(3, 3), (index{0, 3}));
+  EXPECT_EQ(proxy.value(3), 2);
+
+  static_assert(decltype(proxy)::compressed(kColumn));
+}
+
+}  // namespace tests
@@ -0,0 +1,192 @@
+#include "storage/instrumented_storage_proxy.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <ranges>
+#include <thread>
+
+#include "matrices/matrix.hpp"
+#include "matrices/matrix_view.hpp"
+#include "ranges/tagged_random_access_range.hpp"
+#include "storage/const_callable_storage_proxy.hpp"
+#include "storage/strided_storage_proxy.hpp"
+
+namespace tests {
+
+using namespace matrix_views::matrices;
+using namespace matrix_views::ranges;
+using namespace matrix_views::storage;
+using namespace matrix_views::utils;
+using matrix_views::utils::index;
+
+namespace {
+
+auto kRowColumnStorageProxy =
+    const_callable_storage_proxy([](index index) {
+      return static_cast<int>(10 * index.row + index.column);
+    });
+
+template <typename Site, bool Timing = false>
+auto make_view(std::size_t rows, std::size_t columns) {
+  return matrix_view(instrumented<Site, Timing, true>(kRowColumnStorageProxy),
+                     rows, columns);
+}
+
+int row_column(index index) {
+  return static_cast<int>(10 * index.row + index.column);
+}
+
+struct final_storage_proxy final {
+  int operator()(index index) const { return row_column(index); }
+};
+
+}  // namespace
+
+TEST(instrumented_storage_proxy, disabled) {
+  // Compiles to the wrapped proxy, strided proxies stay strided
+  using strided_t = strided_storage_proxy<int, 4, 1>;
+  using disabled_t = instrumented_storage_proxy<strided_t, void, false, false>;
+  static_assert(sizeof(disabled_t) == sizeof(strided_t));
+  static_assert(std::is_base_of_v<strided_t, disabled_t>);
+  static_assert(std::ranges::contiguous_range<
+                tagged_random_access_range<kRowTag, disabled_t>>);
+
+  struct site final {};
+  auto m = matrix<int>(3, 4);
+  std::iota(m.data(), m.data() + m.size(), 0);
+  const auto view =
+      matrix_view(instrumented<site, false, false>(m.storage()), 3, 4);
+  EXPECT_EQ(std::accumulate(view.row(1).begin(), view.row(1).end(), 0), 22);
+  EXPECT_EQ(access_profiler<site>::collect().accesses(), 0);
+}
+
+TEST(instrumented_storage_proxy, disabled_over_non_derivable_proxies) {
+  // Function pointers and final classes are held instead of derived from
+  const auto pointer =
+      matrix_view(instrumented<void, false, false>(&row_column), 3, 4);
+  const auto held =
+      matrix_view(instrumented<void, false, false>(final_storage_proxy()), 3,
+                  4);
+  EXPECT_TRUE(std::ranges::equal(pointer.row(2), std::array{20, 21, 22, 23}));
+  EXPECT_TRUE(std::ranges::equal(held.column(1), std::array{1, 11, 21}));
+  static_assert(std::is_empty_v<
+                instrumented_storage_proxy<final_storage_proxy, void, false,
+                                           false>>);
+}
+
+TEST(instrumented_storage_proxy, directions_and_stripes) {
+  struct site final {};
+  const auto view = make_view<site>(4, 5);
+
+  for (const auto row : rows(view)) {
+    EXPECT_EQ(std::accumulate(row.begin(), row.end(), 0),
+              static_cast<int>(50 * row.origin().row + 10));
+  }
+  auto profile = access_profiler<site>::collect();
+  EXPECT_EQ(profile.accesses(), 20);
+  EXPECT_EQ(profile.moves(kRow), 16);
+  EXPECT_EQ(profile.jumps(), 3);
+  EXPECT_EQ(profile.stripes(kRow).size(), 4);
+  EXPECT_EQ(profile.stripes(kRow).at(2), 4);
+  EXPECT_EQ(profile.strides()[1], 16);
+
+  access_profiler<site>::reset();
+  for (const auto element : view.column(3)) {
+    static_cast<void>(element);
+  }
+  for (const auto element : view.diagonal(-1)) {
+    static_cast<void>(element);
+  }
+  for (const auto element : view.antidiagonal(4)) {
+    static_cast<void>(element);
+  }
+
+  profile = access_profiler<site>::collect();
+  EXPECT_EQ(profile.accesses(), 4 + 3 + 4);
+  EXPECT_EQ(profile.moves(kColumn), 3);
+  EXPECT_EQ(profile.stripes(kColumn).at(3), 3);
+  EXPECT_EQ(profile.moves(kDiagonal), 2);
+  EXPECT_EQ(profile.stripes(kDiagonal).at(-1), 2);
+  EXPECT_EQ(profile.moves(kAntidiagonal), 3);
+  EXPECT_EQ(profile.stripes(kAntidiagonal).at(4), 3);
+  EXPECT_EQ(profile.moves(kRow), 0);
+  EXPECT_EQ(profile.jumps(), 2);
+}
+
+TEST(instrumented_storage_proxy, strides) {
+  struct site final {};
+  const auto view = make_view<site>(1, 64);
+
+  const auto every_fifth = stride<5>(view.row(0));
+  EXPECT_EQ(std::accumulate(every_fifth.begin(), every_fifth.end(), 0),
+            5 * (12 * 13 / 2));
+
+  const auto profile = access_profiler<site>::collect();
+  EXPECT_EQ(profile.accesses(), 13);
+  EXPECT_EQ(profile.strides()[3], 12);
+  EXPECT_EQ(profile.moves(kRow), 12);
+}
+
+TEST(instrumented_storage_proxy, threads) {
+  struct site final {};
+  const auto view = make_view<site>(8, 8);
+
+  // Profiles of exited threads are kept
+  auto threads = std::array<std::thread, 4>();
+  for (std::size_t i = 0; i < threads.size(); ++i) {
+    threads[i] = std::thread([&view, i] {
+      for (const auto element : view.row(static_cast<std::ptrdiff_t>(i))) {
+        static_cast<void>(element);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (const auto element : view.row(7)) {
+    static_cast<void>(element);
+  }
+
+  const auto profile = access_profiler<site>::collect();
+  EXPECT_EQ(profile.accesses(), 5 * 8);
+  EXPECT_EQ(profile.moves(kRow), 5 * 7);
+  EXPECT_EQ(profile.jumps(), 0);
+  EXPECT_EQ(profile.stripes(kRow).size(), 5);
+}
+
+TEST(instrumented_storage_proxy, distant_stripes) {
+  struct site final {};
+  constexpr auto kMaxStripes = access_profiler<site>::kMaxStripes;
+  const auto view =
+      make_view<site>(static_cast<std::size_t>(kMaxStripes) + 1, 3);
+
+  // Moves along stripes past the limit count in the directions only
+  for (const auto i : {kMaxStripes - 1, kMaxStripes}) {
+    for (const auto element : view.row(i)) {
+      static_cast<void>(element);
+    }
+  }
+
+  const auto profile = access_profiler<site>::collect();
+  EXPECT_EQ(profile.moves(kRow), 4);
+  EXPECT_EQ(profile.stripes(kRow).size(), 1);
+  EXPECT_EQ(profile.stripes(kRow).at(kMaxStripes - 1), 2);
+}
+
+TEST(instrumented_storage_proxy, timing) {
+  struct site final {};
+  const auto view = make_view<site, true>(16, 16);
+
+  for (const auto row : rows(view)) {
+    EXPECT_EQ(row[1], static_cast<int>(10 * row.origin().row + 1));
+  }
+
+  const auto profile = access_profiler<site>::collect();
+  EXPECT_EQ(profile.accesses(), 16);
+  EXPECT_GT(profile.ticks(), 0);
+}
+
+}  // namespace tests
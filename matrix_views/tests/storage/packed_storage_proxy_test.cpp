@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <numeric>
+#include <type_traits>
+
+#include "storage/banded_storage_proxy.hpp"
+#include "storage/packed_symmetric_storage_proxy.hpp"
+#include "storage/packed_triangular_storage_proxy.hpp"
+
+namespace tests {
+
+using namespace matrix_views::storage;
+using namespace matrix_views::utils;
+using matrix_views::utils::index;
+
+namespace {
+
+// Packed 4x4 triangle or band of 3 diagonals of a 4x4 matrix, e.g. the
+// tridiagonal one, stored as 4 rows of 3 diagonals. The value of every
+// element equals its offset plus one, so that stored cells are never zero
+constexpr auto kPacked = [] {
+  std::array<int, 12> packed;
+  std::iota(packed.begin(), packed.end(), 1);
+  return packed;
+}();
+
+}  // namespace
+
+TEST(packed_triangular_storage_proxy, upper) {
+  const auto proxy =
+      packed_triangular_storage_proxy<const int, kUpperTag, 4>(kPacked.data());
+
+  // 1  2  3  4
+  // 0  5  6  7
+  // 0  0  8  9
+  // 0  0  0 10
+  EXPECT_EQ(proxy({0, 0}), 1);
+  EXPECT_EQ(proxy({0, 3}), 4);
+  EXPECT_EQ(proxy({1, 1}), 5);
+  EXPECT_EQ(proxy({2, 3}), 9);
+  EXPECT_EQ(proxy({3, 3}), 10);
+  EXPECT_EQ(proxy({1, 0}), 0);
+  EXPECT_EQ(proxy({3, 2}), 0);
+  EXPECT_EQ(proxy.band(), std::make_pair(std::ptrdiff_t(0), std::ptrdiff_t(3)));
+}
+
+TEST(packed_triangular_storage_proxy, lower) {
+  const auto proxy = packed_triangular_storage_proxy<const int, kLowerTag>(
+      kPacked.data(), 4);
+
+  // 1  0  0  0
+  // 2  3  0  0
+  // 4  5  6  0
+  // 7  8  9 10
+  EXPECT_EQ(proxy({0, 0}), 1);
+  EXPECT_EQ(proxy({1, 0}), 2);
+  EXPECT_EQ(proxy({2, 1}), 5);
+  EXPECT_EQ(proxy({3, 0}), 7);
+  EXPECT_EQ(proxy({3, 3}), 10);
+  EXPECT_EQ(proxy({0, 1}), 0);
+  EXPECT_EQ(proxy({2, 3}), 0);
+  EXPECT_EQ(proxy.band(),
+            std::make_pair(std::ptrdiff_t(-3), std::ptrdiff_t(0)));
+}
+
+TEST(packed_symmetric_storage_proxy, mirrored_reads) {
+  const auto upper =
+      packed_symmetric_storage_proxy<const int, kUpperTag>(kPacked.data(), 4);
+  const auto lower =
+      packed_symmetric_storage_proxy<const int, kLowerTag, 4>(kPacked.data());
+
+  for (std::ptrdiff_t i = 0; i < 4; ++i) {
+    for (std::ptrdiff_t j = 0; j < 4; ++j) {
+      EXPECT_EQ(upper({i, j}), upper({j, i}));
+      EXPECT_EQ(lower({i, j}), lower({j, i}));
+      EXPECT_EQ(&upper({i, j}), &upper({j, i}));
+    }
+  }
+  EXPECT_EQ(upper({2, 0}), 3);
+  EXPECT_EQ(lower({0, 2}), 4);
+}
+
+TEST(packed_symmetric_storage_proxy, mirrored_writes) {
+  std::array<int, 6> packed{};
+  const auto proxy = packed_symmetric_storage_proxy<int, kUpperTag, 3>(
+      packed.data());
+
+  proxy({2, 0}) = 42;
+  EXPECT_EQ(proxy({0, 2}), 42);
+  EXPECT_EQ(packed[2], 42);
+}
+
+TEST(banded_storage_proxy, tridiagonal) {
+  const auto proxy = banded_storage_proxy<const int, 1, 1>(kPacked.data());
+
+  // Unused slots of the first and the last rows are 1 and 12
+  //  2  3  0  0
+  //  4  5  6  0
+  //  0  7  8  9
+  //  0  0 10 11
+  EXPECT_EQ(proxy({0, 0}), 2);
+  EXPECT_EQ(proxy({0, 1}), 3);
+  EXPECT_EQ(proxy({1, 0}), 4);
+  EXPECT_EQ(proxy({2, 3}), 9);
+  EXPECT_EQ(proxy({3, 3}), 11);
+  EXPECT_EQ(proxy({0, 2}), 0);
+  EXPECT_EQ(proxy({3, 0}), 0);
+  EXPECT_EQ(proxy.band(),
+            std::make_pair(std::ptrdiff_t(-1), std::ptrdiff_t(1)));
+}
+
+TEST(banded_storage_proxy, dynamic_bandwidths) {
+  const auto proxy = banded_storage_proxy<const int>(kPacked.data(), 0, 2);
+
+  // 1  2  3  0
+  // 0  4  5  6
+  // 0  0  7  8
+  // 0  0  0 10
+  EXPECT_EQ(proxy({0, 2}), 3);
+  EXPECT_EQ(proxy({1, 3}), 6);
+  EXPECT_EQ(proxy({2, 2}), 7);
+  EXPECT_EQ(proxy({3, 3}), 10);
+  EXPECT_EQ(proxy({0, 3}), 0);
+  EXPECT_EQ(proxy({1, 0}), 0);
+}
+
+TEST(packed_storage_proxy, dynamic_extents_are_required) {
+  static_assert(!std::is_constructible_v<
+                packed_triangular_storage_proxy<const int, kLowerTag>,
+                const int*>);
+  static_assert(!std::is_constructible_v<
+                packed_symmetric_storage_proxy<const int, kUpperTag>,
+                const int*>);
+  static_assert(
+      !std::is_constructible_v<banded_storage_proxy<const int, 1>, const int*>);
+
+  EXPECT_DEATH((packed_triangular_storage_proxy<const int, kUpperTag, 4>(
+                   kPacked.data(), 3)),
+               "");
+  EXPECT_DEATH((banded_storage_proxy<const int, 1, 1>(kPacked.data(), 1, 2)),
+               "");
+}
+
+}  // namespace tests
@@ -0,0 +1,138 @@
+#include "storage/strided_storage_proxy.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <numeric>
+
+#include "iterators/tagged_random_access_iterator.hpp"
+
+namespace tests {
+
+using namespace matrix_views::iterators;
+using namespace matrix_views::storage;
+using namespace matrix_views::utils;
+using matrix_views::utils::index;
+
+namespace {
+
+// 3x4 row-major matrix with the value of every element equal to its offset
+constexpr auto kMatrix = [] {
+  std::array<int, 12> matrix;
+  std::iota(matrix.begin(), matrix.end(), 0);
+  return matrix;
+}();
+
+using dynamic_strided_storage_proxy_t =
+    strided_storage_proxy<const int, std::dynamic_extent, std::dynamic_extent>;
+using static_strided_storage_proxy_t = strided_storage_proxy<const int, 4, 1>;
+
+}  // namespace
+
+TEST(strided_storage_proxy, enforce_concept) {
+  static_assert(tagged_random_access_iterator_strided_storage_proxy<
+                dynamic_strided_storage_proxy_t, kRowTag>);
+  static_assert(tagged_random_access_iterator_strided_storage_proxy<
+                static_strided_storage_proxy_t, kAntidiagonalTag>);
+  static_assert(std::random_access_iterator<
+                tagged_random_access_iterator<kRowTag,
+                                              static_strided_storage_proxy_t>>);
+
+  // Const proxy types keep the strided path
+  static_assert(tagged_random_access_iterator_strided_storage_proxy<
+                const dynamic_strided_storage_proxy_t, kColumnTag>);
+  static_assert(std::contiguous_iterator<tagged_random_access_iterator<
+                    kRowTag, const static_strided_storage_proxy_t>>);
+}
+
+TEST(strided_storage_proxy, static_sizeof) {
+  static_assert(sizeof(static_strided_storage_proxy_t) == sizeof(const int*));
+  static_assert(
+      sizeof(tagged_random_access_iterator<kColumnTag,
+                                           static_strided_storage_proxy_t>) ==
+      sizeof(index) + sizeof(const int*));
+}
+
+TEST(strided_storage_proxy, default_constructor) {
+  EXPECT_EQ(static_strided_storage_proxy_t().data(), nullptr);
+}
+
+TEST(strided_storage_proxy, call_operator) {
+  const auto dynamic_proxy =
+      dynamic_strided_storage_proxy_t(kMatrix.data(), 4, 1);
+  const auto static_proxy = static_strided_storage_proxy_t(kMatrix.data());
+
+  EXPECT_EQ(dynamic_proxy({2, 3}), 11);
+  EXPECT_EQ(static_proxy({1, 2}), 6);
+  EXPECT_EQ(&static_proxy({0, 0}), kMatrix.data());
+}
+
+TEST(strided_storage_proxy, column_major_call_operator) {
+  const auto proxy = strided_storage_proxy<const int, 1, std::dynamic_extent>(
+      kMatrix.data(), std::dynamic_extent, 3);
+
+  EXPECT_EQ(proxy({2, 3}), 11);
+  EXPECT_EQ(proxy({1, 0}), 1);
+  EXPECT_EQ(proxy({0, 1}), 3);
+}
+
+TEST(strided_storage_proxy, stride) {
+  const auto proxy = static_strided_storage_proxy_t(kMatrix.data());
+
+  EXPECT_EQ(proxy.stride(kRow), 1);
+  EXPECT_EQ(proxy.stride(kColumn), 4);
+  EXPECT_EQ(proxy.stride(kDiagonal), 5);
+  EXPECT_EQ(proxy.stride(kAntidiagonal), 3);
+}
+
+TEST(strided_storage_proxy, row_iterator) {
+  auto it = tagged_random_access_iterator(
+      kRow, {1, 1}, static_strided_storage_proxy_t(kMatrix.data()));
+
+  EXPECT_EQ(*it, 5);
+  EXPECT_EQ(*++it, 6);
+  EXPECT_EQ(it[1], 7);
+  EXPECT_EQ(*(it - 2), 4);
+  EXPECT_EQ(&*it, &kMatrix[6]);
+}
+
+TEST(strided_storage_proxy, column_iterator) {
+  auto it = tagged_random_access_iterator(
+      kColumn, {0, 2}, dynamic_strided_storage_proxy_t(kMatrix.data(), 4, 1));
+
+  EXPECT_EQ(*it, 2);
+  EXPECT_EQ(*++it, 6);
+  EXPECT_EQ(it[1], 10);
+  EXPECT_EQ(*(it - 1), 2);
+}
+
+TEST(strided_storage_proxy, diagonal_iterator) {
+  auto it = tagged_random_access_iterator(
+      kDiagonal, {0, 1}, static_strided_storage_proxy_t(kMatrix.data()));
+
+  EXPECT_EQ(*it, 1);
+  EXPECT_EQ(*++it, 6);
+  EXPECT_EQ(it[1], 11);
+}
+
+TEST(strided_storage_proxy, antidiagonal_iterator) {
+  auto it = tagged_random_access_iterator(
+      kAntidiagonal, {0, 3}, static_strided_storage_proxy_t(kMatrix.data()));
+
+  EXPECT_EQ(*it, 3);
+  EXPECT_EQ(*++it, 6);
+  EXPECT_EQ(it[1], 9);
+}
+
+TEST(strided_storage_proxy, iterator_distance_and_comparison) {
+  const auto it1 = tagged_random_access_iterator(
+      kRow, {1, 0}, static_strided_storage_proxy_t(kMatrix.data()));
+  const auto it2 = it1 + 3;
+
+  EXPECT_EQ(it2 - it1, 3);
+  EXPECT_LT(it1, it2);
+  EXPECT_EQ(it2 - 3, it1);
+  EXPECT_EQ(std::accumulate(it1, it2, 0), 4 + 5 + 6);
+}
+
+}  // namespace tests
@@ -0,0 +1,63 @@
+#include "utils/semiregular_box.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+namespace tests {
+
+using namespace matrix_views::utils;
+
+TEST(semiregular_box, semiregular_sizeof) {
+  auto lambda = [](int value) { return value; };
+  static_assert(std::is_empty_v<semiregular_box<decltype(lambda)>>);
+  static_assert(sizeof(semiregular_box<int>) == sizeof(int));
+}
+
+TEST(semiregular_box, semiregular_star_operator) {
+  semiregular_box<int> v(1);
+  static_assert(std::is_same_v<decltype(*v), int&>);
+  EXPECT_EQ(*v, 1);
+  EXPECT_EQ(*semiregular_box<int>(), 0);
+}
+
+TEST(semiregular_box, trivially_copyable_sizeof) {
+  int value = 0;
+  auto lambda = [&value](int) { return value; };
+  static_assert(!std::semiregular<decltype(lambda)>);
+  static_assert(sizeof(semiregular_box<decltype(lambda)>) == sizeof(lambda));
+}
+
+TEST(semiregular_box, trivially_copyable_assignment) {
+  int value1 = 1, value2 = 2;
+  auto lambda = [](const int* value) { return [value] { return *value; }; };
+
+  semiregular_box<decltype(lambda(nullptr))> v1(lambda(&value1));
+  semiregular_box<decltype(lambda(nullptr))> v2(lambda(&value2));
+  semiregular_box<decltype(lambda(nullptr))> v3;
+  EXPECT_EQ((*v1)(), 1);
+
+  v1 = v2;
+  EXPECT_EQ((*v1)(), 2);
+
+  v3 = v1;
+  EXPECT_EQ((*v3)(), 2);
+}
+
+TEST(semiregular_box, fallback_assignment) {
+  auto lambda = [](int value) {
+    return [value = std::make_shared<int>(value)] { return *value; };
+  };
+
+  semiregular_box<decltype(lambda(0))> v1(lambda(1));
+  semiregular_box<decltype(lambda(0))> v2(lambda(2));
+  EXPECT_EQ((*v1)(), 1);
+
+  v1 = v2;
+  EXPECT_EQ((*v1)(), 2);
+
+  v1 = semiregular_box<decltype(lambda(0))>(lambda(3));
+  EXPECT_EQ((*v1)(), 3);
+}
+
+}  // namespace tests
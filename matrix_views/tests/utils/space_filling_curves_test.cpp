@@ -0,0 +1,67 @@
+#include "utils/space_filling_curves.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+
+namespace tests {
+
+using namespace matrix_views::utils;
+using matrix_views::utils::index;
+
+TEST(space_filling_curves, curve_order) {
+  static_assert(curve_order(0, 0) == 0);
+  static_assert(curve_order(1, 1) == 0);
+  static_assert(curve_order(2, 1) == 1);
+  static_assert(curve_order(5, 3) == 3);
+  static_assert(curve_order(8, 8) == 3);
+  static_assert(curve_order(1, 9) == 4);
+}
+
+TEST(space_filling_curves, morton) {
+  static_assert(morton_encode({0, 0}) == 0);
+  static_assert(morton_encode({0, 1}) == 1);
+  static_assert(morton_encode({1, 0}) == 2);
+  static_assert(morton_encode({1, 1}) == 3);
+  static_assert(morton_encode({0, 2}) == 4);
+  static_assert(morton_encode({2, 0}) == 8);
+  static_assert(morton_decode(15) == index{3, 3});
+
+  // Compile-time and runtime paths agree, whichever instructions are used
+  for (std::ptrdiff_t row = 0; row < 70; row += 3) {
+    for (std::ptrdiff_t column = 0; column < 70; column += 5) {
+      const auto position = morton_encode({row, column});
+      EXPECT_EQ(morton_decode(position), (index{row, column}));
+    }
+  }
+
+  const auto far = index{(1l << 31) + 5, (1l << 30) + 7};
+  EXPECT_EQ(morton_decode(morton_encode(far)), far);
+}
+
+TEST(space_filling_curves, hilbert) {
+  static_assert(hilbert_decode(0, 1) == index{0, 0});
+  static_assert(hilbert_decode(1, 1) == index{0, 1});
+  static_assert(hilbert_decode(2, 1) == index{1, 1});
+  static_assert(hilbert_decode(3, 1) == index{1, 0});
+
+  for (int order = 0; order <= 5; ++order) {
+    const auto side = std::ptrdiff_t(1) << order;
+    auto previous = hilbert_decode(0, order);
+    EXPECT_EQ(previous, (index{0, 0}));
+
+    for (std::uint64_t position = 0;
+         position < static_cast<std::uint64_t>(side * side); ++position) {
+      const auto cell = hilbert_decode(position, order);
+      EXPECT_EQ(hilbert_encode(cell, order), position);
+
+      // Every step moves to an adjacent cell
+      EXPECT_EQ(std::abs(cell.row - previous.row) +
+                    std::abs(cell.column - previous.column),
+                position == 0 ? 0 : 1);
+      previous = cell;
+    }
+  }
+}
+
+}  // namespace tests